@@ -0,0 +1,352 @@
+/*
+ * charclass.c - Character class scanning: trim, span and find_any_of.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * The set of characters is turned into a 256 bit table, laid out as two
+ * 16 byte rows indexed by the low nibble of a byte, where each bit of a
+ * row stands for one value of the high nibble. That makes the membership
+ * test two pshufb lookups and an and, so the SSSE3 and AVX2 kernels
+ * classify 16 or 32 bytes per step.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str.h"
+#include "wstr.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h> // memmove
+#include <wchar.h>  // wcschr
+#include "util.h"
+#include "internal.h"
+
+#ifdef X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+#define WHITESPACE " \t\n\v\f\r"
+#define WWHITESPACE L" \t\n\v\f\r"
+
+struct charclass {
+	uint8_t lo[16]; // lo[l] bit h: byte (h << 4 | l), for h < 8
+	uint8_t hi[16]; // hi[l] bit h: byte ((h + 8) << 4 | l)
+};
+
+static INLINE void __class_add(struct charclass *cc, unsigned char c){
+	uint8_t *row = c & 0x80 ? cc->hi : cc->lo;
+	row[c & 0xF] |= 1 << ((c >> 4) & 7);
+}
+
+static INLINE int __in_class(const struct charclass *cc, unsigned char c){
+	const uint8_t *row = c & 0x80 ? cc->hi : cc->lo;
+	return (row[c & 0xF] >> ((c >> 4) & 7)) & 1;
+}
+
+static void __class_init(struct charclass *cc, const char *chars){
+	memset(cc, 0, sizeof(*cc));
+	for (; *chars; chars++)
+		__class_add(cc, *chars);
+}
+
+#ifdef X86_DISPATCH
+
+static INLINE SSSE3 unsigned __member_mask_16(const struct charclass *cc, __m128i x){
+	const __m128i nibble = _mm_set1_epi8(0x0F);
+	const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+					   1, 2, 4, 8, 16, 32, 64, -128);
+	__m128i lo = _mm_and_si128(x, nibble);
+	__m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+	__m128i row_lo = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)cc->lo), lo);
+	__m128i row_hi = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)cc->hi), lo);
+	__m128i high = _mm_cmpgt_epi8(_mm_setzero_si128(), x);
+	__m128i row = _mm_or_si128(_mm_and_si128(high, row_hi), _mm_andnot_si128(high, row_lo));
+	__m128i bit = _mm_shuffle_epi8(bits, hi);
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit));
+}
+
+static INLINE AVX2 unsigned __member_mask_32(const struct charclass *cc, __m256i x){
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	const __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+					      1, 2, 4, 8, 16, 32, 64, -128,
+					      1, 2, 4, 8, 16, 32, 64, -128,
+					      1, 2, 4, 8, 16, 32, 64, -128);
+	__m256i lo = _mm256_and_si256(x, nibble);
+	__m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+	__m256i row_lo = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)cc->lo)), lo);
+	__m256i row_hi = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)cc->hi)), lo);
+	/* blendv picks by the top bit of each byte of x */
+	__m256i row = _mm256_blendv_epi8(row_lo, row_hi, x);
+	__m256i bit = _mm256_shuffle_epi8(bits, hi);
+	return _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit));
+}
+
+/*
+ * The kernels skip whole blocks where no byte has membership == in_set.
+ * __scan_* returns how many bytes from the start can be skipped, and
+ * __rscan_* the position from which all the bytes until n can be skipped.
+ */
+
+static SSSE3 size_t __scan_ssse3(const struct charclass *cc, const char *p, size_t n, int in_set){
+	unsigned flip = in_set ? 0 : 0xFFFF;
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16){
+		unsigned mask = __member_mask_16(cc, _mm_loadu_si128((const __m128i*)&p[i])) ^ flip;
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+	return i;
+}
+
+static AVX2 size_t __scan_avx2(const struct charclass *cc, const char *p, size_t n, int in_set){
+	unsigned flip = in_set ? 0 : 0xFFFFFFFF;
+	size_t i = 0;
+	for (; i + 32 <= n; i += 32){
+		unsigned mask = __member_mask_32(cc, _mm256_loadu_si256((const __m256i*)&p[i])) ^ flip;
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+	return i + __scan_ssse3(cc, &p[i], n - i, in_set);
+}
+
+static SSSE3 size_t __rscan_ssse3(const struct charclass *cc, const char *p, size_t n, int in_set){
+	unsigned flip = in_set ? 0 : 0xFFFF;
+	size_t j = n;
+	for (; j >= 16; j -= 16){
+		unsigned mask = __member_mask_16(cc, _mm_loadu_si128((const __m128i*)&p[j - 16])) ^ flip;
+		if (mask)
+			return j - 16 + (32 - __builtin_clz(mask));
+	}
+	return j;
+}
+
+static AVX2 size_t __rscan_avx2(const struct charclass *cc, const char *p, size_t n, int in_set){
+	unsigned flip = in_set ? 0 : 0xFFFFFFFF;
+	size_t j = n;
+	for (; j >= 32; j -= 32){
+		unsigned mask = __member_mask_32(cc, _mm256_loadu_si256((const __m256i*)&p[j - 32])) ^ flip;
+		if (mask)
+			return j - 32 + (32 - __builtin_clz(mask));
+	}
+	return __rscan_ssse3(cc, p, j, in_set);
+}
+
+#endif
+
+/* Returns the position of the first byte whose membership is in_set, or n */
+static size_t __scan(const struct charclass *cc, const char *p, size_t n, int in_set){
+	size_t i = DISPATCH(0, __scan, cc, p, n, in_set);
+	while (i < n && __in_class(cc, p[i]) != in_set)
+		i++;
+	return i;
+}
+
+/* Returns one past the last byte whose membership is in_set, or 0 */
+static size_t __rscan(const struct charclass *cc, const char *p, size_t n, int in_set){
+	size_t j = DISPATCH(n, __rscan, cc, p, n, in_set);
+	while (j > 0 && __in_class(cc, p[j - 1]) != in_set)
+		j--;
+	return j;
+}
+
+static void __rtrim(string_t *str, const struct charclass *cc){
+	size_t end = __rscan(cc, str->buffer, str->length, 0);
+	if (end < str->length){
+		__str_modified(str, end);
+		str->length = end;
+		str->buffer[end] = '\0';
+	}
+}
+
+static void __ltrim(string_t *str, const struct charclass *cc){
+	size_t start = __scan(cc, str->buffer, str->length, 0);
+	if (start > 0){
+		__str_modified(str, 0);
+		str->length -= start;
+		memmove(str->buffer, &str->buffer[start], str->length * sizeof(char));
+		str->buffer[str->length] = '\0';
+	}
+}
+
+int str_trim(string_t *str, const char *chars){
+	if (!str)
+		return -1;
+	struct charclass cc;
+	__class_init(&cc, chars ? chars : WHITESPACE);
+	__rtrim(str, &cc);
+	__ltrim(str, &cc);
+	return 1;
+}
+
+int str_ltrim(string_t *str, const char *chars){
+	if (!str)
+		return -1;
+	struct charclass cc;
+	__class_init(&cc, chars ? chars : WHITESPACE);
+	__ltrim(str, &cc);
+	return 1;
+}
+
+int str_rtrim(string_t *str, const char *chars){
+	if (!str)
+		return -1;
+	struct charclass cc;
+	__class_init(&cc, chars ? chars : WHITESPACE);
+	__rtrim(str, &cc);
+	return 1;
+}
+
+static int __find(const string_t *str, const char *chars, unsigned start_at, int in_set){
+	if (!str || !chars)
+		return -2;
+	if (start_at >= str->length)
+		return -3;
+	struct charclass cc;
+	__class_init(&cc, chars);
+	size_t i = start_at + __scan(&cc, &str->buffer[start_at], str->length - start_at, in_set);
+	return i < str->length ? (int)i : -1;
+}
+
+int str_find_any_of(const string_t *str, const char *chars, unsigned start_at){
+	return __find(str, chars, start_at, 1);
+}
+
+int str_find_not_of(const string_t *str, const char *chars, unsigned start_at){
+	return __find(str, chars, start_at, 0);
+}
+
+static size_t __span(const string_t *str, const char *chars, unsigned start_at, int in_set){
+	if (!str || !chars || start_at >= str->length)
+		return 0;
+	struct charclass cc;
+	__class_init(&cc, chars);
+	return __scan(&cc, &str->buffer[start_at], str->length - start_at, in_set);
+}
+
+size_t str_span(const string_t *str, const char *accept, unsigned start_at){
+	return __span(str, accept, start_at, 0);
+}
+
+size_t str_cspan(const string_t *str, const char *reject, unsigned start_at){
+	return __span(str, reject, start_at, 1);
+}
+
+/*
+ * The wide versions use the same table for the chars below 256, and
+ * look up the rest in the set itself. Compact Latin-1 strings only hold
+ * chars below 256, so they go through the byte kernels.
+ */
+
+struct wcharclass {
+	struct charclass bytes;
+	const wchar_t *wide;
+};
+
+static void __wclass_init(struct wcharclass *wc, const wchar_t *chars){
+	memset(&wc->bytes, 0, sizeof(wc->bytes));
+	wc->wide = NULL;
+	for (const wchar_t *c = chars; *c; c++){
+		if ((uint32_t)*c < 0x100)
+			__class_add(&wc->bytes, *c);
+		else
+			wc->wide = chars;
+	}
+}
+
+static INLINE int __in_wclass(const struct wcharclass *wc, wchar_t c){
+	if ((uint32_t)c < 0x100)
+		return __in_class(&wc->bytes, c);
+	return wc->wide && wcschr(wc->wide, c) != NULL;
+}
+
+static size_t __wscan(const wstring_t *wstr, const struct wcharclass *wc, size_t i, int in_set){
+	if (wstr->char_size == 1)
+		return i + __scan(&wc->bytes, (const char*)wstr->buffer + i, wstr->length - i, in_set);
+	while (i < wstr->length && __in_wclass(wc, __wstr_get(wstr, i)) != in_set)
+		i++;
+	return i;
+}
+
+static size_t __wrscan(const wstring_t *wstr, const struct wcharclass *wc, int in_set){
+	if (wstr->char_size == 1)
+		return __rscan(&wc->bytes, wstr->buffer, wstr->length, in_set);
+	size_t j = wstr->length;
+	while (j > 0 && __in_wclass(wc, __wstr_get(wstr, j - 1)) != in_set)
+		j--;
+	return j;
+}
+
+static void __wrtrim(wstring_t *wstr, const struct wcharclass *wc){
+	size_t end = __wrscan(wstr, wc, 0);
+	if (end < wstr->length)
+		__wstr_set_length(wstr, end);
+}
+
+static void __wltrim(wstring_t *wstr, const struct wcharclass *wc){
+	size_t start = __wscan(wstr, wc, 0, 0);
+	if (start > 0){
+		size_t len = wstr->length - start;
+		memmove(wstr->buffer, (char*)wstr->buffer + start * wstr->char_size, len * wstr->char_size);
+		__wstr_set_length(wstr, len);
+	}
+}
+
+int wstr_trim(wstring_t *wstr, const wchar_t *chars){
+	if (!wstr)
+		return -1;
+	struct wcharclass wc;
+	__wclass_init(&wc, chars ? chars : WWHITESPACE);
+	__wrtrim(wstr, &wc);
+	__wltrim(wstr, &wc);
+	return 1;
+}
+
+int wstr_ltrim(wstring_t *wstr, const wchar_t *chars){
+	if (!wstr)
+		return -1;
+	struct wcharclass wc;
+	__wclass_init(&wc, chars ? chars : WWHITESPACE);
+	__wltrim(wstr, &wc);
+	return 1;
+}
+
+int wstr_rtrim(wstring_t *wstr, const wchar_t *chars){
+	if (!wstr)
+		return -1;
+	struct wcharclass wc;
+	__wclass_init(&wc, chars ? chars : WWHITESPACE);
+	__wrtrim(wstr, &wc);
+	return 1;
+}
+
+static int __wfind(const wstring_t *wstr, const wchar_t *chars, unsigned start_at, int in_set){
+	if (!wstr || !chars)
+		return -2;
+	if (start_at >= wstr->length)
+		return -3;
+	struct wcharclass wc;
+	__wclass_init(&wc, chars);
+	size_t i = __wscan(wstr, &wc, start_at, in_set);
+	return i < wstr->length ? (int)i : -1;
+}
+
+int wstr_find_any_of(const wstring_t *wstr, const wchar_t *chars, unsigned start_at){
+	return __wfind(wstr, chars, start_at, 1);
+}
+
+int wstr_find_not_of(const wstring_t *wstr, const wchar_t *chars, unsigned start_at){
+	return __wfind(wstr, chars, start_at, 0);
+}
+
+static size_t __wspan(const wstring_t *wstr, const wchar_t *chars, unsigned start_at, int in_set){
+	if (!wstr || !chars || start_at >= wstr->length)
+		return 0;
+	struct wcharclass wc;
+	__wclass_init(&wc, chars);
+	return __wscan(wstr, &wc, start_at, in_set) - start_at;
+}
+
+size_t wstr_span(const wstring_t *wstr, const wchar_t *accept, unsigned start_at){
+	return __wspan(wstr, accept, start_at, 0);
+}
+
+size_t wstr_cspan(const wstring_t *wstr, const wchar_t *reject, unsigned start_at){
+	return __wspan(wstr, reject, start_at, 1);
+}
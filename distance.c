@@ -0,0 +1,330 @@
+/*
+ * distance.c - Levenshtein distance between strings.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Uses Myers' bit-parallel algorithm, as formulated by Hyyrö: a column
+ * of the DP matrix is kept as two bit vectors with the vertical +1/-1
+ * deltas, so each character of the text costs a handful of word
+ * operations per 64 characters of the pattern. Longer patterns are
+ * split in blocks of 64 rows that pass the horizontal delta down.
+ * Only the score of the last row is tracked, which is enough to stop
+ * as soon as the distance can't be within the bound anymore.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str.h"
+#include "wstr.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memset
+#include <wchar.h>
+#include "util.h"
+#include "internal.h"
+
+#ifdef X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+#define HIGH_BIT (1ULL << 63)
+
+/*
+ * Match masks of the pattern: for every character, the rows of each
+ * block where it appears. Characters below 256 are looked up directly,
+ * the rest in a small open addressing table.
+ */
+struct pattern {
+	size_t m, blocks;
+	uint64_t *peq;   // [257][blocks], the last row is all zeros
+	uint64_t *state; // Pv and Mv of each block
+	uint32_t *keys;  // wide characters, 0 marks an empty slot
+	uint64_t *wpeq;  // [cap][blocks]
+	unsigned shift;  // 32 - log2(cap), 0 if there is no table
+	uint64_t small_peq[257];
+	uint64_t small_state[2];
+};
+
+/* width is the char_size of s, so compact wstring_ts are read as they are */
+static INLINE uint32_t __char(const void *s, size_t i, unsigned width){
+	return __wchar_at(s, i, width);
+}
+
+static INLINE size_t __hash(const struct pattern *p, uint32_t c){
+	return (uint32_t)(c * 0x9E3779B1u) >> p->shift;
+}
+
+static INLINE const uint64_t* __eq(const struct pattern *p, uint32_t c){
+	if (c < 256)
+		return &p->peq[c * p->blocks];
+	if (p->shift){
+		size_t mask = (1UL << (32 - p->shift)) - 1;
+		for (size_t h = __hash(p, c); p->keys[h]; h = (h + 1) & mask){
+			if (p->keys[h] == c)
+				return &p->wpeq[h * p->blocks];
+		}
+	}
+	return &p->peq[256 * p->blocks];
+}
+
+static uint64_t* __eq_slot(struct pattern *p, uint32_t c){
+	if (c < 256)
+		return &p->peq[c * p->blocks];
+	size_t mask = (1UL << (32 - p->shift)) - 1;
+	size_t h = __hash(p, c);
+	while (p->keys[h] && p->keys[h] != c)
+		h = (h + 1) & mask;
+	p->keys[h] = c;
+	return &p->wpeq[h * p->blocks];
+}
+
+static void __pattern_init(struct pattern *p, const void *s, size_t m, unsigned width){
+	p->m = m;
+	p->blocks = (m + 63) / 64;
+	if (p->blocks == 1){
+		p->peq = p->small_peq;
+		p->state = p->small_state;
+		memset(p->peq, 0, sizeof(p->small_peq));
+	} else {
+		p->peq = calloc(257 * p->blocks, sizeof(uint64_t));
+		p->state = malloc(2 * p->blocks * sizeof(uint64_t));
+		assert(p->peq && p->state);
+	}
+	p->keys = NULL;
+	p->wpeq = NULL;
+	p->shift = 0;
+	size_t n_wide = 0;
+	for (size_t i = 0; i < m; i++){
+		if (__char(s, i, width) >= 256)
+			n_wide++;
+	}
+	if (n_wide > 0){
+		unsigned bits = 1;
+		while ((1UL << bits) < 2 * n_wide)
+			bits++;
+		p->shift = 32 - bits;
+		p->keys = calloc(1UL << bits, sizeof(uint32_t));
+		p->wpeq = calloc((1UL << bits) * p->blocks, sizeof(uint64_t));
+		assert(p->keys && p->wpeq);
+	}
+	for (size_t i = 0; i < m; i++)
+		__eq_slot(p, __char(s, i, width))[i / 64] |= 1ULL << (i % 64);
+}
+
+static void __pattern_free(struct pattern *p){
+	if (p->blocks > 1){
+		free(p->peq);
+		free(p->state);
+	}
+	free(p->keys);
+	free(p->wpeq);
+}
+
+/*
+ * Advances one block of the column by one character of the text.
+ * hin is the horizontal delta entering the top of the block, and the
+ * return value the one leaving it at the row marked by [out].
+ */
+static INLINE int __advance(uint64_t *pv, uint64_t *mv, uint64_t eq, int hin, uint64_t out){
+	uint64_t xv = eq | *mv;
+	if (hin < 0)
+		eq |= 1;
+	uint64_t xh = (((eq & *pv) + *pv) ^ *pv) | eq;
+	uint64_t ph = *mv | ~(xh | *pv);
+	uint64_t mh = *pv & xh;
+	int hout = (ph & out) ? 1 : (mh & out) ? -1 : 0;
+	ph <<= 1;
+	mh <<= 1;
+	if (hin < 0)
+		mh |= 1;
+	else if (hin > 0)
+		ph |= 1;
+	*pv = mh | ~(xv | ph);
+	*mv = ph & xv;
+	return hout;
+}
+
+/*
+ * Distance between the pattern and text, or -2 if it's greater than k.
+ */
+static long __distance(struct pattern *p, const void *text, size_t n, unsigned width, size_t k){
+	size_t blocks = p->blocks;
+	uint64_t *pv = p->state, *mv = &p->state[blocks];
+	uint64_t last = 1ULL << ((p->m - 1) % 64);
+	for (size_t b = 0; b < blocks; b++){
+		pv[b] = ~0ULL;
+		mv[b] = 0;
+	}
+	size_t score = p->m;
+	for (size_t j = 0; j < n; j++){
+		const uint64_t *eq = __eq(p, __char(text, j, width));
+		int h = 1;
+		for (size_t b = 0; b + 1 < blocks; b++)
+			h = __advance(&pv[b], &mv[b], eq[b], h, HIGH_BIT);
+		score += __advance(&pv[blocks - 1], &mv[blocks - 1], eq[blocks - 1], h, last);
+		/* Each remaining character lowers the score by one at most */
+		size_t left = n - j - 1;
+		if (score > left && score - left > k)
+			return -2;
+	}
+	return score > k ? -2 : (long)score;
+}
+
+static long __pair(const void *a, size_t na, unsigned wa, const void *b, size_t nb, unsigned wb, size_t k){
+	if (na > nb){
+		const void *tmp = a;
+		a = b;
+		b = tmp;
+		size_t ntmp = na;
+		na = nb;
+		nb = ntmp;
+		unsigned wtmp = wa;
+		wa = wb;
+		wb = wtmp;
+	}
+	if (nb - na > k)
+		return -2;
+	if (na == 0)
+		return nb;
+	struct pattern p;
+	__pattern_init(&p, a, na, wa);
+	long dist = __distance(&p, b, nb, wb, k);
+	__pattern_free(&p);
+	return dist;
+}
+
+long str_edit_distance(const string_t *a, const string_t *b){
+	return str_edit_distance_max(a, b, SIZE_MAX);
+}
+
+long str_edit_distance_max(const string_t *a, const string_t *b, size_t k){
+	if (!a || !b)
+		return -1;
+	return __pair(a->buffer, a->length, 1, b->buffer, b->length, 1, k);
+}
+
+long wstr_edit_distance(const wstring_t *a, const wstring_t *b){
+	return wstr_edit_distance_max(a, b, SIZE_MAX);
+}
+
+long wstr_edit_distance_max(const wstring_t *a, const wstring_t *b, size_t k){
+	if (!a || !b)
+		return -1;
+	return __pair(a->buffer, a->length, a->char_size, b->buffer, b->length, b->char_size, k);
+}
+
+#ifdef X86_DISPATCH
+
+/*
+ * Runs a query of up to 64 characters against 4 texts at once, one per
+ * 64 bit lane. Lanes keep running past the end of their text, so the
+ * score of each one is taken when its last character is reached.
+ */
+static AVX2 void __batch4_avx2(const uint64_t *peq, size_t m, const unsigned char *const t[4],
+			       const size_t len[4], long out[4]){
+	const __m256i one = _mm256_set1_epi64x(1);
+	const __m256i all = _mm256_set1_epi64x(-1);
+	const __m128i shift = _mm_cvtsi32_si128(m - 1);
+	__m256i pv = all, mv = _mm256_setzero_si256();
+	__m256i score = _mm256_set1_epi64x(m), result = score;
+	__m256i lens = _mm256_setr_epi64x(len[0], len[1], len[2], len[3]);
+	size_t max = 0;
+	for (int i = 0; i < 4; i++){
+		if (len[i] > max)
+			max = len[i];
+	}
+	for (size_t j = 0; j < max; j++){
+		__m256i eq = _mm256_setr_epi64x(j < len[0] ? peq[t[0][j]] : 0,
+						j < len[1] ? peq[t[1][j]] : 0,
+						j < len[2] ? peq[t[2][j]] : 0,
+						j < len[3] ? peq[t[3][j]] : 0);
+		__m256i xv = _mm256_or_si256(eq, mv);
+		__m256i xh = _mm256_or_si256(_mm256_xor_si256(_mm256_add_epi64(_mm256_and_si256(eq, pv), pv), pv), eq);
+		__m256i ph = _mm256_or_si256(mv, _mm256_andnot_si256(_mm256_or_si256(xh, pv), all));
+		__m256i mh = _mm256_and_si256(pv, xh);
+		score = _mm256_add_epi64(score, _mm256_and_si256(_mm256_srl_epi64(ph, shift), one));
+		score = _mm256_sub_epi64(score, _mm256_and_si256(_mm256_srl_epi64(mh, shift), one));
+		ph = _mm256_or_si256(_mm256_slli_epi64(ph, 1), one);
+		mh = _mm256_slli_epi64(mh, 1);
+		pv = _mm256_or_si256(mh, _mm256_andnot_si256(_mm256_or_si256(xv, ph), all));
+		mv = _mm256_and_si256(ph, xv);
+		__m256i done = _mm256_cmpeq_epi64(lens, _mm256_set1_epi64x(j + 1));
+		result = _mm256_blendv_epi8(result, score, done);
+	}
+	_mm256_storeu_si256((__m256i*)out, result);
+}
+
+#endif
+
+int str_edit_distance_batch(const string_t *query, string_t *const *candidates, size_t n, size_t k, long *out){
+	if (!query || !candidates || !out)
+		return -1;
+	size_t m = query->length;
+	struct pattern p;
+	if (m > 0)
+		__pattern_init(&p, query->buffer, m, 1);
+#ifdef X86_DISPATCH
+	int simd = m > 0 && m <= 64 && __builtin_cpu_supports("avx2");
+	const unsigned char *t[4];
+	size_t len[4], idx[4], pending = 0;
+	long res[4];
+#endif
+	for (size_t i = 0; i < n; i++){
+		const string_t *c = candidates[i];
+		if (!c){
+			out[i] = -1;
+			continue;
+		}
+		size_t diff = c->length > m ? c->length - m : m - c->length;
+		if (diff > k){
+			out[i] = -2;
+		} else if (m == 0){
+			out[i] = c->length;
+#ifdef X86_DISPATCH
+		} else if (simd){
+			t[pending] = (const unsigned char*)c->buffer;
+			len[pending] = c->length;
+			idx[pending++] = i;
+			if (pending == 4){
+				__batch4_avx2(p.peq, m, t, len, res);
+				for (int j = 0; j < 4; j++)
+					out[idx[j]] = (size_t)res[j] > k ? -2 : res[j];
+				pending = 0;
+			}
+#endif
+		} else {
+			out[i] = __distance(&p, c->buffer, c->length, 1, k);
+		}
+	}
+#ifdef X86_DISPATCH
+	for (size_t j = 0; j < pending; j++)
+		out[idx[j]] = __distance(&p, t[j], len[j], 1, k);
+#endif
+	if (m > 0)
+		__pattern_free(&p);
+	return 1;
+}
+
+int wstr_edit_distance_batch(const wstring_t *query, wstring_t *const *candidates, size_t n, size_t k, long *out){
+	if (!query || !candidates || !out)
+		return -1;
+	size_t m = query->length;
+	struct pattern p;
+	if (m > 0)
+		__pattern_init(&p, query->buffer, m, query->char_size);
+	for (size_t i = 0; i < n; i++){
+		const wstring_t *c = candidates[i];
+		if (!c){
+			out[i] = -1;
+			continue;
+		}
+		size_t diff = c->length > m ? c->length - m : m - c->length;
+		if (diff > k)
+			out[i] = -2;
+		else if (m == 0)
+			out[i] = c->length;
+		else
+			out[i] = __distance(&p, c->buffer, c->length, c->char_size, k);
+	}
+	if (m > 0)
+		__pattern_free(&p);
+	return 1;
+}
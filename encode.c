@@ -0,0 +1,351 @@
+/*
+ * encode.c - Base64 and hex encoding into string_t.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * The output size is always computed up front, so the destination is
+ * reserved exactly once. On x86 the bulk of the data goes through SSSE3
+ * or AVX2 kernels, picked at runtime, and the scalar code handles the
+ * tails and any block the kernels refuse (invalid characters, padding).
+ * The base64 kernels follow the pshufb based algorithms by Wojciech Muła
+ * and Daniel Lemire.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h> // memcpy
+#include "util.h"
+#include "internal.h"
+
+#ifdef X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+static const char __b64_chars[] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char __hex_chars[] = "0123456789abcdef";
+
+static INLINE int __b64_value(unsigned char c){
+	if (c >= 'A' && c <= 'Z')
+		return c - 'A';
+	if (c >= 'a' && c <= 'z')
+		return c - 'a' + 26;
+	if (c >= '0' && c <= '9')
+		return c - '0' + 52;
+	if (c == '+')
+		return 62;
+	if (c == '/')
+		return 63;
+	return -1;
+}
+
+static INLINE int __hex_value(unsigned char c){
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	c |= 0x20;
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return -1;
+}
+
+#ifdef X86_DISPATCH
+
+/* 12 bytes (of the 16 loaded) to 16 base64 chars */
+static INLINE SSSE3 __m128i __b64_enc_block(__m128i in){
+	in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+	__m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+	__m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+	__m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+	__m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+	__m128i idx = _mm_or_si128(t1, t3);
+
+	__m128i shift = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+	__m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), idx);
+	shift = _mm_or_si128(shift, _mm_and_si128(less, _mm_set1_epi8(13)));
+	const __m128i shift_lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+						'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+						'0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+	return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, shift), idx);
+}
+
+/*
+ * 16 base64 chars to 12 bytes, in the low 12 bytes of *out.
+ * @return 0 if the block has a char outside the alphabet
+ */
+static INLINE SSSE3 int __b64_dec_block(__m128i in, __m128i *out){
+	const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+					     0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+	const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+					     0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+					       0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i nibble = _mm_set1_epi8(0x0F);
+	__m128i hi = _mm_and_si128(_mm_srli_epi32(in, 4), nibble);
+	__m128i lo = _mm_and_si128(in, nibble);
+	__m128i bad = _mm_and_si128(_mm_shuffle_epi8(lut_lo, lo), _mm_shuffle_epi8(lut_hi, hi));
+	if (_mm_movemask_epi8(_mm_cmpeq_epi8(bad, _mm_setzero_si128())) != 0xFFFF)
+		return 0;
+	__m128i is_slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+	__m128i values = _mm_add_epi8(in, _mm_shuffle_epi8(lut_roll, _mm_add_epi8(is_slash, hi)));
+
+	__m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+	merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+	*out = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+						      -1, -1, -1, -1));
+	return 1;
+}
+
+/* 16 bytes to 32 hex chars */
+static INLINE SSSE3 void __hex_enc_block(__m128i in, __m128i *lo_out, __m128i *hi_out){
+	const __m128i lut = _mm_loadu_si128((const __m128i*)__hex_chars);
+	const __m128i nibble = _mm_set1_epi8(0x0F);
+	__m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(in, 4), nibble));
+	__m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(in, nibble));
+	*lo_out = _mm_unpacklo_epi8(hi, lo);
+	*hi_out = _mm_unpackhi_epi8(hi, lo);
+}
+
+/*
+ * Converts 16 hex chars to their values.
+ * @return 0 if any of them is not a hex digit
+ */
+static INLINE SSSE3 int __hex_values(__m128i in, __m128i *out){
+	__m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+	__m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+	__m128i alpha = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+	__m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+	if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF)
+		return 0;
+	alpha = _mm_add_epi8(alpha, _mm_set1_epi8(10));
+	*out = _mm_or_si128(_mm_and_si128(is_digit, digit), _mm_andnot_si128(is_digit, alpha));
+	return 1;
+}
+
+/*
+ * Each kernel works on whole blocks and returns the number of
+ * input bytes it consumed. The AVX2 ones finish with the SSSE3 ones.
+ */
+
+static SSSE3 size_t __b64_encode_ssse3(const unsigned char *src, size_t n, char *out){
+	size_t i = 0;
+	for (; i + 16 <= n; i += 12, out += 16)
+		_mm_storeu_si128((__m128i*)out, __b64_enc_block(_mm_loadu_si128((const __m128i*)&src[i])));
+	return i;
+}
+
+static AVX2 size_t __b64_encode_avx2(const unsigned char *src, size_t n, char *out){
+	size_t i = 0;
+	for (; i + 28 <= n; i += 24, out += 32){
+		__m128i a = __b64_enc_block(_mm_loadu_si128((const __m128i*)&src[i]));
+		__m128i b = __b64_enc_block(_mm_loadu_si128((const __m128i*)&src[i + 12]));
+		_mm256_storeu_si256((__m256i*)out, _mm256_inserti128_si256(_mm256_castsi128_si256(a), b, 1));
+	}
+	return i + __b64_encode_ssse3(&src[i], n - i, out);
+}
+
+/* out_room: bytes that can be written to out, the blocks write 16 */
+static SSSE3 size_t __b64_decode_ssse3(const char *src, size_t n, unsigned char *out, size_t out_room){
+	size_t i = 0;
+	__m128i block;
+	for (; i + 16 <= n && out_room >= 16; i += 16, out += 12, out_room -= 12){
+		if (!__b64_dec_block(_mm_loadu_si128((const __m128i*)&src[i]), &block))
+			break;
+		_mm_storeu_si128((__m128i*)out, block);
+	}
+	return i;
+}
+
+static AVX2 size_t __b64_decode_avx2(const char *src, size_t n, unsigned char *out, size_t out_room){
+	size_t i = 0;
+	__m128i a, b;
+	for (; i + 32 <= n && out_room >= 28; i += 32, out += 24, out_room -= 24){
+		if (!__b64_dec_block(_mm_loadu_si128((const __m128i*)&src[i]), &a)
+		    || !__b64_dec_block(_mm_loadu_si128((const __m128i*)&src[i + 16]), &b))
+			break;
+		_mm_storeu_si128((__m128i*)out, a);
+		_mm_storeu_si128((__m128i*)&out[12], b);
+	}
+	return i + __b64_decode_ssse3(&src[i], n - i, out, out_room);
+}
+
+static SSSE3 size_t __hex_encode_ssse3(const unsigned char *src, size_t n, char *out){
+	size_t i = 0;
+	__m128i lo, hi;
+	for (; i + 16 <= n; i += 16, out += 32){
+		__hex_enc_block(_mm_loadu_si128((const __m128i*)&src[i]), &lo, &hi);
+		_mm_storeu_si128((__m128i*)out, lo);
+		_mm_storeu_si128((__m128i*)&out[16], hi);
+	}
+	return i;
+}
+
+static AVX2 size_t __hex_encode_avx2(const unsigned char *src, size_t n, char *out){
+	const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)__hex_chars));
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	size_t i = 0;
+	for (; i + 32 <= n; i += 32, out += 64){
+		__m256i in = _mm256_loadu_si256((const __m256i*)&src[i]);
+		__m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble));
+		__m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(in, nibble));
+		__m256i a = _mm256_unpacklo_epi8(hi, lo);
+		__m256i b = _mm256_unpackhi_epi8(hi, lo);
+		_mm256_storeu_si256((__m256i*)out, _mm256_permute2x128_si256(a, b, 0x20));
+		_mm256_storeu_si256((__m256i*)&out[32], _mm256_permute2x128_si256(a, b, 0x31));
+	}
+	return i + __hex_encode_ssse3(&src[i], n - i, out);
+}
+
+/* Consumes 32 hex chars per block */
+static SSSE3 size_t __hex_decode_ssse3(const char *src, size_t n, unsigned char *out){
+	const __m128i weights = _mm_set1_epi16(0x0110);
+	size_t i = 0;
+	__m128i a, b;
+	for (; i + 32 <= n; i += 32, out += 16){
+		if (!__hex_values(_mm_loadu_si128((const __m128i*)&src[i]), &a)
+		    || !__hex_values(_mm_loadu_si128((const __m128i*)&src[i + 16]), &b))
+			break;
+		a = _mm_maddubs_epi16(a, weights);
+		b = _mm_maddubs_epi16(b, weights);
+		_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(a, b));
+	}
+	return i;
+}
+
+static AVX2 size_t __hex_decode_avx2(const char *src, size_t n, unsigned char *out){
+	const __m128i weights = _mm_set1_epi16(0x0110);
+	size_t i = 0;
+	__m128i v[4];
+	for (; i + 64 <= n; i += 64, out += 32){
+		int ok = 1;
+		for (int k = 0; k < 4 && ok; k++)
+			ok = __hex_values(_mm_loadu_si128((const __m128i*)&src[i + 16 * k]), &v[k]);
+		if (!ok)
+			break;
+		__m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(v[0]), v[1], 1);
+		__m256i y = _mm256_inserti128_si256(_mm256_castsi128_si256(v[2]), v[3], 1);
+		x = _mm256_maddubs_epi16(x, _mm256_broadcastsi128_si256(weights));
+		y = _mm256_maddubs_epi16(y, _mm256_broadcastsi128_si256(weights));
+		/* packus works per lane: [x0 y0 x1 y1] -> [x0 x1 y0 y1] */
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(x, y), 0xD8);
+		_mm256_storeu_si256((__m256i*)out, packed);
+	}
+	return i + __hex_decode_ssse3(&src[i], n - i, out);
+}
+
+#endif
+
+int str_append_base64(string_t *dst, const void *src, size_t n){
+	if (!dst || (!src && n > 0))
+		return -1;
+	size_t out_len = (n + 2) / 3 * 4;
+	__str_reserve(dst, out_len);
+	const unsigned char *in = src;
+	char *out = &dst->buffer[dst->length];
+	size_t i = DISPATCH(0, __b64_encode, in, n, out);
+	out += i / 3 * 4;
+	for (; i + 3 <= n; i += 3){
+		uint32_t v = (uint32_t)in[i] << 16 | in[i + 1] << 8 | in[i + 2];
+		*out++ = __b64_chars[v >> 18];
+		*out++ = __b64_chars[(v >> 12) & 0x3F];
+		*out++ = __b64_chars[(v >> 6) & 0x3F];
+		*out++ = __b64_chars[v & 0x3F];
+	}
+	if (i < n){
+		uint32_t v = (uint32_t)in[i] << 16;
+		if (i + 1 < n)
+			v |= in[i + 1] << 8;
+		*out++ = __b64_chars[v >> 18];
+		*out++ = __b64_chars[(v >> 12) & 0x3F];
+		*out++ = i + 1 < n ? __b64_chars[(v >> 6) & 0x3F] : '=';
+		*out++ = '=';
+	}
+	dst->length += out_len;
+	dst->buffer[dst->length] = '\0';
+	return 1;
+}
+
+static INLINE int __fail(string_t *dst, size_t *error_at, size_t offset){
+	if (error_at)
+		*error_at = offset;
+	dst->buffer[dst->length] = '\0';
+	return -2;
+}
+
+int str_decode_base64(string_t *dst, const char *src, unsigned n, size_t *error_at){
+	if (!dst || !src)
+		return -1;
+	size_t len = strnlen(src, n);
+	size_t m = len;
+	if (m > 0 && src[m - 1] == '=')
+		m--;
+	if (m > 0 && src[m - 1] == '=')
+		m--;
+	if (m < len && len % 4 != 0)
+		return __fail(dst, error_at, m);
+	if (m % 4 == 1)
+		return __fail(dst, error_at, m - 1);
+	size_t out_len = m / 4 * 3 + (m % 4 == 0 ? 0 : m % 4 - 1);
+	__str_reserve(dst, out_len);
+
+	unsigned char *out = (unsigned char*)&dst->buffer[dst->length];
+	size_t i = DISPATCH(0, __b64_decode, src, m, out, out_len);
+	out += i / 4 * 3;
+	while (i < m){
+		uint32_t v = 0;
+		size_t group = m - i < 4 ? m - i : 4;
+		for (size_t k = 0; k < group; k++){
+			int d = __b64_value(src[i + k]);
+			if (d < 0)
+				return __fail(dst, error_at, i + k);
+			v |= (uint32_t)d << (18 - 6 * k);
+		}
+		*out++ = v >> 16;
+		if (group > 2)
+			*out++ = v >> 8;
+		if (group > 3)
+			*out++ = v;
+		i += group;
+	}
+	dst->length += out_len;
+	dst->buffer[dst->length] = '\0';
+	return 1;
+}
+
+int str_append_hex(string_t *dst, const void *src, size_t n){
+	if (!dst || (!src && n > 0))
+		return -1;
+	__str_reserve(dst, n * 2);
+	const unsigned char *in = src;
+	char *out = &dst->buffer[dst->length];
+	size_t i = DISPATCH(0, __hex_encode, in, n, out);
+	for (out += i * 2; i < n; i++){
+		*out++ = __hex_chars[in[i] >> 4];
+		*out++ = __hex_chars[in[i] & 0xF];
+	}
+	dst->length += n * 2;
+	dst->buffer[dst->length] = '\0';
+	return 1;
+}
+
+int str_decode_hex(string_t *dst, const char *src, unsigned n, size_t *error_at){
+	if (!dst || !src)
+		return -1;
+	size_t len = strnlen(src, n);
+	size_t out_len = len / 2;
+	__str_reserve(dst, out_len);
+	unsigned char *out = (unsigned char*)&dst->buffer[dst->length];
+	size_t i = DISPATCH(0, __hex_decode, src, len & ~(size_t)1, out);
+	for (out += i / 2; i + 1 < len; i += 2){
+		int hi = __hex_value(src[i]), lo = __hex_value(src[i + 1]);
+		if (hi < 0)
+			return __fail(dst, error_at, i);
+		if (lo < 0)
+			return __fail(dst, error_at, i + 1);
+		*out++ = hi << 4 | lo;
+	}
+	if (len % 2 != 0)
+		return __fail(dst, error_at, len - 1);
+	dst->length += out_len;
+	dst->buffer[dst->length] = '\0';
+	return 1;
+}
@@ -0,0 +1,348 @@
+/*
+ * escape.c - JSON, HTML and URL escaping into string_t.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Escaping takes two passes over the source. The first one computes the
+ * exact size of the output, so the destination is reserved only once,
+ * and the second one copies the spans of clean bytes with memcpy and
+ * escapes the rest. Both passes look for the bytes that need escaping
+ * 16 at a time with SSE2.
+ * Unescaping never makes the text longer, so the destination is
+ * reserved for the length of the source.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h> // memcpy, memchr
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "util.h"
+#include "internal.h"
+
+enum escape_kind { JSON, HTML, URL };
+
+static const char __hex_lower[] = "0123456789abcdef";
+static const char __hex_upper[] = "0123456789ABCDEF";
+
+static INLINE int __is_unreserved(unsigned char c){
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+	       || c == '-' || c == '_' || c == '.' || c == '~';
+}
+
+static INLINE int __is_special(enum escape_kind kind, unsigned char c){
+	switch (kind){
+	case JSON: return c < 0x20 || c == '"' || c == '\\';
+	case HTML: return c == '&' || c == '<' || c == '>' || c == '"' || c == '\'';
+	default:   return !__is_unreserved(c);
+	}
+}
+
+#ifdef __SSE2__
+/* (x - lo) <= (hi - lo), as unsigned bytes */
+static INLINE __m128i __in_range(__m128i x, char lo, char hi){
+	__m128i y = _mm_sub_epi8(x, _mm_set1_epi8(lo));
+	__m128i range = _mm_set1_epi8(hi - lo);
+	return _mm_cmpeq_epi8(_mm_min_epu8(y, range), y);
+}
+
+static INLINE __m128i __eq(__m128i x, char c){
+	return _mm_cmpeq_epi8(x, _mm_set1_epi8(c));
+}
+
+/* Bit i is set if p[i] needs escaping */
+static INLINE unsigned __special_mask(enum escape_kind kind, const char *p){
+	__m128i x = _mm_loadu_si128((const __m128i*)p);
+	__m128i m;
+	switch (kind){
+	case JSON:
+		m = _mm_or_si128(__in_range(x, 0, 0x1F), _mm_or_si128(__eq(x, '"'), __eq(x, '\\')));
+		break;
+	case HTML:
+		m = _mm_or_si128(_mm_or_si128(__eq(x, '&'), __eq(x, '<')),
+				 _mm_or_si128(_mm_or_si128(__eq(x, '>'), __eq(x, '"')), __eq(x, '\'')));
+		break;
+	default:
+		m = _mm_or_si128(__in_range(_mm_or_si128(x, _mm_set1_epi8(0x20)), 'a', 'z'),
+				 __in_range(x, '0', '9'));
+		m = _mm_or_si128(m, _mm_or_si128(_mm_or_si128(__eq(x, '-'), __eq(x, '_')),
+						 _mm_or_si128(__eq(x, '.'), __eq(x, '~'))));
+		return ~_mm_movemask_epi8(m) & 0xFFFF;
+	}
+	return _mm_movemask_epi8(m);
+}
+#endif
+
+/* Returns the position of the first byte in [i, len) that needs escaping */
+static INLINE size_t __next_special(enum escape_kind kind, const char *src, size_t i, size_t len){
+#ifdef __SSE2__
+	for (; i + 16 <= len; i += 16){
+		unsigned mask = __special_mask(kind, &src[i]);
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+#endif
+	while (i < len && !__is_special(kind, src[i]))
+		i++;
+	return i;
+}
+
+static INLINE size_t __escaped_len(enum escape_kind kind, unsigned char c){
+	switch (kind){
+	case JSON:
+		switch (c){
+		case '"': case '\\': case '\b': case '\f':
+		case '\n': case '\r': case '\t':
+			return 2;
+		}
+		return c < 0x20 ? 6 : 1;
+	case HTML:
+		switch (c){
+		case '&':  return 5;
+		case '<':  return 4;
+		case '>':  return 4;
+		case '"':  return 6;
+		case '\'': return 5;
+		}
+		return 1;
+	default:
+		return __is_unreserved(c) ? 1 : 3;
+	}
+}
+
+static INLINE char* __put(char *out, const char *s, size_t n){
+	memcpy(out, s, n);
+	return out + n;
+}
+
+static INLINE char* __emit(enum escape_kind kind, unsigned char c, char *out){
+	switch (kind){
+	case JSON:
+		*out++ = '\\';
+		switch (c){
+		case '"':  *out++ = '"'; break;
+		case '\\': *out++ = '\\'; break;
+		case '\b': *out++ = 'b'; break;
+		case '\f': *out++ = 'f'; break;
+		case '\n': *out++ = 'n'; break;
+		case '\r': *out++ = 'r'; break;
+		case '\t': *out++ = 't'; break;
+		default:
+			out = __put(out, "u00", 3);
+			*out++ = __hex_lower[c >> 4];
+			*out++ = __hex_lower[c & 0xF];
+		}
+		return out;
+	case HTML:
+		switch (c){
+		case '&':  return __put(out, "&amp;", 5);
+		case '<':  return __put(out, "&lt;", 4);
+		case '>':  return __put(out, "&gt;", 4);
+		case '"':  return __put(out, "&quot;", 6);
+		default:   return __put(out, "&#39;", 5);
+		}
+	default:
+		*out++ = '%';
+		*out++ = __hex_upper[c >> 4];
+		*out++ = __hex_upper[c & 0xF];
+		return out;
+	}
+}
+
+static INLINE int __escape(string_t *dst, const char *src, unsigned n, enum escape_kind kind){
+	if (!dst || !src)
+		return -1;
+	size_t len = strnlen(src, n);
+	size_t out_len = len;
+	size_t i = 0;
+#ifdef __SSE2__
+	for (; i + 16 <= len; i += 16){
+		for (unsigned mask = __special_mask(kind, &src[i]); mask; mask &= mask - 1)
+			out_len += __escaped_len(kind, src[i + __builtin_ctz(mask)]) - 1;
+	}
+#endif
+	for (; i < len; i++)
+		out_len += __escaped_len(kind, src[i]) - 1;
+	__str_reserve(dst, out_len);
+
+	char *out = &dst->buffer[dst->length];
+	for (i = 0; i < len; i++){
+		size_t next = __next_special(kind, src, i, len);
+		out = __put(out, &src[i], next - i);
+		if (next == len)
+			break;
+		out = __emit(kind, src[next], out);
+		i = next;
+	}
+	dst->length += out_len;
+	dst->buffer[dst->length] = '\0';
+	return 1;
+}
+
+int str_escape_json(string_t *dst, const char *src, unsigned n){
+	return __escape(dst, src, n, JSON);
+}
+
+int str_escape_html(string_t *dst, const char *src, unsigned n){
+	return __escape(dst, src, n, HTML);
+}
+
+int str_url_encode(string_t *dst, const char *src, unsigned n){
+	return __escape(dst, src, n, URL);
+}
+
+static INLINE int __hex_value(unsigned char c){
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	c |= 0x20;
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return -1;
+}
+
+static long __parse_hex(const char *p, size_t n){
+	long v = 0;
+	for (size_t i = 0; i < n; i++){
+		int d = __hex_value(p[i]);
+		if (d < 0)
+			return -1;
+		v = v << 4 | d;
+	}
+	return v;
+}
+
+/*
+ * Unescapes the JSON escape sequence at p, which starts with '\'.
+ * @return the number of bytes consumed, or 0 if it's not valid
+ */
+static size_t __unescape_json_seq(const char *p, size_t n, char **out){
+	if (n < 2)
+		return 0;
+	char c;
+	switch (p[1]){
+	case '"':  c = '"'; break;
+	case '\\': c = '\\'; break;
+	case '/':  c = '/'; break;
+	case 'b':  c = '\b'; break;
+	case 'f':  c = '\f'; break;
+	case 'n':  c = '\n'; break;
+	case 'r':  c = '\r'; break;
+	case 't':  c = '\t'; break;
+	case 'u': {
+		long cp = n >= 6 ? __parse_hex(&p[2], 4) : -1;
+		if (cp < 0 || (cp >= 0xDC00 && cp <= 0xDFFF))
+			return 0;
+		if (cp < 0xD800 || cp > 0xDBFF){
+			*out = __put_utf8(*out, cp);
+			return 6;
+		}
+		/* High surrogate, must be followed by a low one */
+		if (n < 12 || p[6] != '\\' || p[7] != 'u')
+			return 0;
+		long low = __parse_hex(&p[8], 4);
+		if (low < 0xDC00 || low > 0xDFFF)
+			return 0;
+		*out = __put_utf8(*out, 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00));
+		return 12;
+	}
+	default:
+		return 0;
+	}
+	*(*out)++ = c;
+	return 2;
+}
+
+static size_t __unescape_url_seq(const char *p, size_t n, char **out){
+	long v = n >= 3 ? __parse_hex(&p[1], 2) : -1;
+	if (v < 0)
+		return 0;
+	*(*out)++ = v;
+	return 3;
+}
+
+static const struct {
+	const char *name;
+	size_t len;
+	char c;
+} __html_entities[] = {
+	{ "&amp;",  5, '&'  },
+	{ "&lt;",   4, '<'  },
+	{ "&gt;",   4, '>'  },
+	{ "&quot;", 6, '"'  },
+	{ "&apos;", 6, '\'' },
+};
+
+/*
+ * Unknown or malformed entities are left as they are, like browsers do,
+ * so this never fails.
+ */
+static size_t __unescape_html_seq(const char *p, size_t n, char **out){
+	for (size_t e = 0; e < sizeof(__html_entities) / sizeof(__html_entities[0]); e++){
+		size_t len = __html_entities[e].len;
+		if (len <= n && memcmp(p, __html_entities[e].name, len) == 0){
+			*(*out)++ = __html_entities[e].c;
+			return len;
+		}
+	}
+	if (n >= 4 && p[1] == '#'){
+		int hex = (p[2] | 0x20) == 'x';
+		size_t i = hex ? 3 : 2;
+		uint32_t cp = 0;
+		size_t digits = 0;
+		for (; i < n && digits < 8; i++, digits++){
+			int d = hex ? __hex_value(p[i]) : (p[i] >= '0' && p[i] <= '9' ? p[i] - '0' : -1);
+			if (d < 0)
+				break;
+			cp = cp * (hex ? 16 : 10) + d;
+		}
+		if (digits > 0 && i < n && p[i] == ';' && cp > 0 && cp <= 0x10FFFF
+		    && (cp < 0xD800 || cp > 0xDFFF)){
+			*out = __put_utf8(*out, cp);
+			return i + 1;
+		}
+	}
+	*(*out)++ = '&';
+	return 1;
+}
+
+static INLINE int __unescape(string_t *dst, const char *src, unsigned n, size_t *error_at,
+			     char special, size_t (*seq)(const char*, size_t, char**)){
+	if (!dst || !src)
+		return -1;
+	size_t len = strnlen(src, n);
+	__str_reserve(dst, len);
+	char *start = &dst->buffer[dst->length];
+	char *out = start;
+	size_t i = 0;
+	while (i < len){
+		const char *match = memchr(&src[i], special, len - i);
+		size_t next = match ? (size_t)(match - src) : len;
+		out = __put(out, &src[i], next - i);
+		if (next == len)
+			break;
+		size_t used = seq(&src[next], len - next, &out);
+		if (used == 0){
+			if (error_at)
+				*error_at = next;
+			dst->buffer[dst->length] = '\0';
+			return -2;
+		}
+		i = next + used;
+	}
+	dst->length += out - start;
+	dst->buffer[dst->length] = '\0';
+	return 1;
+}
+
+int str_unescape_json(string_t *dst, const char *src, unsigned n, size_t *error_at){
+	return __unescape(dst, src, n, error_at, '\\', __unescape_json_seq);
+}
+
+int str_unescape_html(string_t *dst, const char *src, unsigned n){
+	return __unescape(dst, src, n, NULL, '&', __unescape_html_seq);
+}
+
+int str_url_decode(string_t *dst, const char *src, unsigned n, size_t *error_at){
+	return __unescape(dst, src, n, error_at, '%', __unescape_url_seq);
+}
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+#
+# gen_unicode_data.py - generates unicode_data.h, the tables used by
+#                       unicode.c, from Python's unicodedata module.
+# Author: Saúl Valdelvira (2023)
+#
+# Usage: python3 gen_unicode_data.py > unicode_data.h
+#
+# The tables must be regenerated with a Python whose unicodedata has the
+# Unicode version wanted (3.11 ships 14.0.0). str.casefold gives the
+# full case folding (statuses C and F of CaseFolding.txt).
+
+import unicodedata
+
+SHIFT = 6
+BLOCK = 1 << SHIFT
+
+def is_hangul_syllable(c):
+    return 0xAC00 <= c < 0xAC00 + 11172
+
+# Every code point with a property is below the limit, rounded up to a block
+def has_props(c):
+    ch = chr(c)
+    return (unicodedata.combining(ch) != 0
+            or unicodedata.decomposition(ch) != ''
+            or ch.casefold() != ch)
+
+LIMIT = max(c for c in range(0x110000) if has_props(c)) + 1
+LIMIT = (LIMIT + BLOCK - 1) // BLOCK * BLOCK
+
+# Primary composites: canonical pairs that NFC doesn't exclude
+comp = []
+for c in range(LIMIT):
+    d = unicodedata.decomposition(chr(c))
+    if not d or d.startswith('<'):
+        continue
+    parts = [int(x, 16) for x in d.split()]
+    if len(parts) == 2 and unicodedata.normalize('NFC', chr(c)) == chr(c):
+        comp.append((parts[0], parts[1], c))
+comp.sort()
+
+# Characters that can combine with a previous starter, Hangul jamo included
+seconds = {s for _, s, _ in comp}
+seconds |= set(range(0x1161, 0x1176)) | set(range(0x11A8, 0x11C3))
+
+data = []
+props, props_vals = {}, []
+decomp_vals, fold_vals = [], []
+
+def push_seq(s):
+    off = len(data)
+    data.extend(ord(x) for x in s)
+    assert off < 1 << 13 and len(s) < 8
+    return off << 3 | len(s)
+
+for c in range(LIMIT):
+    ch = chr(c)
+    flags = 1 if c in seconds else 0
+    if unicodedata.normalize('NFC', ch) != ch:
+        flags |= 2
+    key = (unicodedata.combining(ch), flags)
+    # unicode.c leaves these composed until something combines with them
+    if key == (0, 0):
+        d = unicodedata.normalize('NFD', ch)
+        assert unicodedata.combining(d[0]) == 0 and ord(d[0]) not in seconds
+    props_vals.append(props.setdefault(key, len(props)))
+    d = unicodedata.normalize('NFD', ch)
+    decomp_vals.append(push_seq(d) if d != ch and not is_hangul_syllable(c) else 0)
+    f = ch.casefold()
+    fold_vals.append(push_seq(f) if f != ch else 0)
+
+def two_stage(vals):
+    blocks, stage1 = {}, []
+    for i in range(0, LIMIT, BLOCK):
+        stage1.append(blocks.setdefault(tuple(vals[i:i + BLOCK]), len(blocks)))
+    assert len(blocks) <= 256
+    return stage1, [v for b in blocks for v in b]
+
+def emit(ctype, name, vals, per_line=16, fmt='{}', dims=''):
+    print(f'static const {ctype} {name}[{len(vals)}]{dims} = {{')
+    for i in range(0, len(vals), per_line):
+        print('\t' + ', '.join(fmt.format(v) for v in vals[i:i + per_line]) + ',')
+    print('};\n')
+
+print(f'''/*
+ * unicode_data.h - Unicode {unicodedata.unidata_version} tables used by unicode.c.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Generated by gen_unicode_data.py, don't edit by hand.
+ *
+ * Each property is a two stage table: stage1[c >> UNI_SHIFT] is the
+ * block of c, and its value is stage2[block << UNI_SHIFT | (c & mask)].
+ * Code points from UNI_LIMIT onwards have no properties.
+ * The decomposition and folding values are the offset of a sequence in
+ * __uni_data << 3 | its length, or 0 if the code point maps to itself.
+ * Decompositions are fully expanded, and Hangul syllables are left to
+ * the algorithm.
+ */
+#ifndef __STR_UNICODE_DATA_H
+#define __STR_UNICODE_DATA_H
+
+#include <stdint.h>
+
+#define UNI_SHIFT {SHIFT}
+#define UNI_LIMIT 0x{LIMIT:X}
+
+/* Can combine with a previous starter */
+#define UNI_SECOND 1
+/* Changes when put in NFC on its own */
+#define UNI_NFC_NO 2
+
+struct uni_props {{
+\tuint8_t ccc;
+\tuint8_t flags;
+}};
+''')
+
+emit('struct uni_props', '__uni_props', [f'{{ {ccc}, {s} }}' for ccc, s in props], per_line=8)
+for name, vals in (('props', props_vals), ('decomp', decomp_vals), ('fold', fold_vals)):
+    stage1, stage2 = two_stage(vals)
+    emit('uint8_t', f'__uni_{name}_stage1', stage1)
+    emit('uint8_t' if name == 'props' else 'uint16_t', f'__uni_{name}_stage2', stage2)
+emit('uint32_t', '__uni_data', data, per_line=8, fmt='0x{:04X}')
+print('/* Primary composites, sorted by the pair they compose */')
+emit('uint32_t', '__uni_comp', [f'{{ 0x{a:04X}, 0x{b:04X}, 0x{c:04X} }}' for a, b, c in comp], per_line=3, dims='[3]')
+print('#endif')
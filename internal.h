@@ -0,0 +1,224 @@
+/*
+ * internal.h - string_t and wstring_t layout, shared between
+ *              the translation units of the library.
+ * Author: Saúl Valdelvira (2023)
+ */
+#ifndef __STR_INTERNAL_H
+#define __STR_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+#include <stdlib.h> // free, realloc
+#include <assert.h>
+#include <stdio.h>  // FILE, fread
+#include <errno.h>
+#include <unistd.h> // read
+
+/*
+ * Sparse code point index of a UTF-8 string_t (see utf8.c).
+ * marks[k] is the byte offset of code point k * UTF8_INDEX_STEP.
+ * Only the bytes in [0, end) have been indexed, and they hold
+ * n_chars code points.
+ */
+#define UTF8_INDEX_STEP 64
+
+struct utf8_index {
+	size_t *marks;
+	size_t  n_marks;
+	size_t  capacity;
+	size_t  end;
+	size_t  n_chars;
+};
+
+/* struct string is public when STR_INLINE is defined */
+#include "str_inline.h"
+
+/*
+ * Must be called when the bytes of str from pos onwards change.
+ * The part of the index before pos is still valid, so appending
+ * never throws it away.
+ */
+static inline void __str_modified(struct string *str, size_t pos){
+	struct utf8_index *idx = str->utf8;
+	if (!idx || idx->end <= pos)
+		return;
+	while (idx->n_marks > 0 && idx->marks[idx->n_marks - 1] >= pos)
+		idx->n_marks--;
+	if (idx->n_marks > 0){
+		idx->end = idx->marks[idx->n_marks - 1];
+		idx->n_chars = (idx->n_marks - 1) * UTF8_INDEX_STEP;
+	} else {
+		idx->end = 0;
+		idx->n_chars = 0;
+	}
+}
+
+/*
+ * Makes *size at least needed, and at least double what it was if it
+ * has to grow, and reallocs buf to hold *size + pad chars.
+ * @return the new buffer
+ */
+static inline char* __grow_chars(char *buf, size_t *size, size_t needed, size_t pad){
+	if (needed <= *size)
+		return buf;
+	size_t new_size = *size * 2;
+	if (needed > new_size)
+		new_size = needed;
+	buf = realloc(buf, (new_size + pad) * sizeof(char));
+	assert(buf);
+	*size = new_size;
+	return buf;
+}
+
+/*
+ * Writes the UTF-8 encoding of the code point cp, which must be valid.
+ * @return the position after the last byte written
+ */
+static inline char* __put_utf8(char *out, uint32_t cp){
+	if (cp < 0x80){
+		*out++ = cp;
+	} else if (cp < 0x800){
+		*out++ = 0xC0 | (cp >> 6);
+		*out++ = 0x80 | (cp & 0x3F);
+	} else if (cp < 0x10000){
+		*out++ = 0xE0 | (cp >> 12);
+		*out++ = 0x80 | ((cp >> 6) & 0x3F);
+		*out++ = 0x80 | (cp & 0x3F);
+	} else {
+		*out++ = 0xF0 | (cp >> 18);
+		*out++ = 0x80 | ((cp >> 12) & 0x3F);
+		*out++ = 0x80 | ((cp >> 6) & 0x3F);
+		*out++ = 0x80 | (cp & 0x3F);
+	}
+	return out;
+}
+
+/*
+ * Builds an empty string_t with room for size chars (at least one),
+ * plus the '\0'. Unlike str_init, size is never truncated to unsigned.
+ */
+static inline struct string* __str_init_sized(size_t size){
+	struct string *str = malloc(sizeof(*str));
+	assert(str);
+	if (size == 0)
+		size = 1;
+	str->buffer = malloc((size + 1) * sizeof(char));
+	assert(str->buffer);
+	str->buffer_size = size;
+	str->length = 0;
+	str->utf8 = NULL;
+	str->buffer[0] = '\0';
+	return str;
+}
+
+/*
+ * Makes room for extra more chars in str, keeping the one for the '\0'.
+ * Unlike str_reserve, sizes are never truncated to unsigned.
+ */
+static inline void __str_reserve(struct string *str, size_t extra){
+	str->buffer = __grow_chars(str->buffer, &str->buffer_size, str->length + extra, 1);
+}
+
+/*
+ * Number of bytes that stdio has already buffered for file,
+ * or 0 if the C library doesn't tell.
+ */
+static inline size_t __file_buffered(FILE *file){
+#if defined(__GLIBC__)
+	return file->_IO_read_end - file->_IO_read_ptr;
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+	return file->_r > 0 ? file->_r : 0;
+#else
+	(void)file;
+	return 0;
+#endif
+}
+
+/*
+ * Reads up to n bytes from file if it's not NULL, or from fd if it is,
+ * without waiting for more than the input has available, so records
+ * coming from a pipe or a terminal are not held back.
+ * For a FILE, the bytes stdio has already buffered are handed back
+ * first, and then each call does a single read of its descriptor.
+ * @return the number of bytes read, 0 at EOF, -1 on error
+ */
+static inline long __read_some(int fd, FILE *file, char *buf, size_t n){
+	if (file){
+		size_t buffered = __file_buffered(file);
+		fd = fileno(file);
+		if (buffered > 0 || fd < 0){
+			if (buffered > 0 && buffered < n)
+				n = buffered;
+			size_t got = fread(buf, 1, n, file);
+			if (got == 0 && ferror(file))
+				return -1;
+			return got;
+		}
+	}
+	long got;
+	do {
+		got = read(fd, buf, n);
+	} while (got < 0 && errno == EINTR);
+	return got;
+}
+
+/*
+ * buffer holds length characters of char_size bytes each (1, 2 or
+ * sizeof(wchar_t)). Unless the string is compact, char_size is always
+ * sizeof(wchar_t) and buffer is a plain wchar_t array.
+ * wide caches a wchar_t copy of a compact buffer, built on demand by
+ * wstr_get_buffer and dropped whenever the string changes. Readers
+ * publish it atomically, since they may race to build it.
+ */
+struct wstring {
+	void*         buffer;
+	size_t        length;
+	size_t        buffer_size;
+	wchar_t*      wide;
+	unsigned char char_size;
+	unsigned char compact;
+};
+
+/*
+ * Must be called when the contents of wstr change, so the
+ * wchar_t copy of a compact buffer is rebuilt.
+ */
+static inline void __wstr_modified(struct wstring *wstr){
+	if (wstr->wide){
+		free(wstr->wide);
+		wstr->wide = NULL;
+	}
+}
+
+/* The i-th character of a buffer of char_size byte characters */
+static inline wchar_t __wchar_at(const void *buf, size_t i, unsigned char_size){
+	switch (char_size){
+	case 1:  return ((const uint8_t*)buf)[i];
+	case 2:  return ((const uint16_t*)buf)[i];
+	default: return ((const wchar_t*)buf)[i];
+	}
+}
+
+/* The i-th character of wstr, whatever its char_size */
+static inline wchar_t __wstr_get(const struct wstring *wstr, size_t i){
+	return __wchar_at(wstr->buffer, i, wstr->char_size);
+}
+
+/* The caller makes sure that c fits in char_size */
+static inline void __wstr_put(struct wstring *wstr, size_t i, wchar_t c){
+	switch (wstr->char_size){
+	case 1:  ((uint8_t*)wstr->buffer)[i] = c; break;
+	case 2:  ((uint16_t*)wstr->buffer)[i] = c; break;
+	default: ((wchar_t*)wstr->buffer)[i] = c; break;
+	}
+}
+
+/* Sets the length of wstr, keeping the L'\0' after the last character */
+static inline void __wstr_set_length(struct wstring *wstr, size_t length){
+	wstr->length = length;
+	__wstr_put(wstr, length, L'\0');
+	__wstr_modified(wstr);
+}
+
+#endif
@@ -0,0 +1,449 @@
+/*
+ * load.c - Batch loading of files into string_t.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * On Linux, all the opens and reads are submitted through an io_uring,
+ * so the kernel works on many files at once instead of waiting for each
+ * blocking read. Where io_uring is not available (old kernels, seccomp
+ * filters, other systems) the files are read with pread from a pool of
+ * threads. Either way each string_t is sized from the file size before
+ * reading, so its buffer is never reallocated.
+ */
+#define _GNU_SOURCE
+#include "str.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include "util.h"
+#include "internal.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+#define MAX_THREADS 16
+#define RING_ENTRIES 256
+#define SMALL_READ 4096
+#define MAX_READ (1U << 30)
+
+/*
+ * Reads the whole file, growing the string as needed.
+ * Used for files whose size is not known up front (size 0 in stat,
+ * like the ones in /proc)
+ */
+static int __read_unsized(int fd, string_t *str){
+	for (;;){
+		if (str->length == str->buffer_size)
+			__str_reserve(str, str->buffer_size + SMALL_READ);
+		ssize_t n = read(fd, &str->buffer[str->length], str->buffer_size - str->length);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			return -1;
+		if (n == 0)
+			break;
+		str->length += n;
+	}
+	str->buffer[str->length] = '\0';
+	return 0;
+}
+
+/*
+ * Builds a string_t with room for size chars, in a single allocation
+ * of its buffer.
+ * @return the string, or NULL if size is not valid
+ */
+static string_t* __str_sized(off_t size){
+	if (size < 0 || (uintmax_t)size >= SIZE_MAX)
+		return NULL;
+	return __str_init_sized(size);
+}
+
+static string_t* __load_file(const char *path){
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return NULL;
+	struct stat st;
+	if (fstat(fd, &st) < 0){
+		close(fd);
+		return NULL;
+	}
+	string_t *str = __str_sized(st.st_size);
+	if (!str){
+		close(fd);
+		return NULL;
+	}
+	int ret;
+	if (st.st_size == 0){
+		ret = __read_unsized(fd, str);
+	} else {
+		ret = 0;
+		while (str->length < (size_t)st.st_size){
+			ssize_t n = pread(fd, &str->buffer[str->length],
+					  st.st_size - str->length, str->length);
+			if (n < 0 && errno == EINTR)
+				continue;
+			if (n <= 0){
+				ret = n;
+				break;
+			}
+			str->length += n;
+		}
+		str->buffer[str->length] = '\0';
+	}
+	close(fd);
+	if (ret < 0){
+		str_free(str);
+		return NULL;
+	}
+	return str;
+}
+
+struct load_job {
+	const char **paths;
+	string_t **out;
+	size_t n;
+	atomic_size_t next;
+	atomic_size_t loaded;
+};
+
+static void* __load_worker(void *arg){
+	struct load_job *job = arg;
+	size_t i;
+	while ((i = atomic_fetch_add(&job->next, 1)) < job->n){
+		job->out[i] = job->paths[i] ? __load_file(job->paths[i]) : NULL;
+		if (job->out[i])
+			atomic_fetch_add(&job->loaded, 1);
+	}
+	return NULL;
+}
+
+static size_t __load_threaded(const char **paths, size_t n, string_t **out){
+	struct load_job job = { .paths = paths, .out = out, .n = n };
+	atomic_init(&job.next, 0);
+	atomic_init(&job.loaded, 0);
+	size_t n_threads = n < MAX_THREADS ? n : MAX_THREADS;
+	pthread_t threads[MAX_THREADS];
+	size_t spawned = 0;
+	while (spawned + 1 < n_threads &&
+	       pthread_create(&threads[spawned], NULL, __load_worker, &job) == 0)
+		spawned++;
+	__load_worker(&job);
+	for (size_t t = 0; t < spawned; t++)
+		pthread_join(threads[t], NULL);
+	return atomic_load(&job.loaded);
+}
+
+#ifdef HAVE_IO_URING
+
+struct uring {
+	int fd;
+	unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+	unsigned *cq_head, *cq_tail, *cq_mask;
+	struct io_uring_sqe *sqes;
+	struct io_uring_cqe *cqes;
+	void *sq_ptr, *cq_ptr;
+	size_t sq_len, cq_len, sqes_len;
+	unsigned entries;
+};
+
+static int __uring_supports(int fd, const int *ops, int n_ops){
+	size_t size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+	struct io_uring_probe *probe = calloc(1, size);
+	if (!probe)
+		return 0;
+	int ok = syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+	for (int i = 0; ok && i < n_ops; i++){
+		ok = ops[i] <= probe->last_op &&
+		     (probe->ops[ops[i]].flags & IO_URING_OP_SUPPORTED);
+	}
+	free(probe);
+	return ok;
+}
+
+static void __uring_exit(struct uring *ring){
+	if (ring->sqes && ring->sqes != MAP_FAILED)
+		munmap(ring->sqes, ring->sqes_len);
+	if (ring->cq_ptr && ring->cq_ptr != MAP_FAILED && ring->cq_ptr != ring->sq_ptr)
+		munmap(ring->cq_ptr, ring->cq_len);
+	if (ring->sq_ptr && ring->sq_ptr != MAP_FAILED)
+		munmap(ring->sq_ptr, ring->sq_len);
+	close(ring->fd);
+}
+
+static int __uring_init(struct uring *ring, unsigned entries){
+	struct io_uring_params p;
+	memset(&p, 0, sizeof(p));
+	memset(ring, 0, sizeof(*ring));
+	ring->fd = syscall(__NR_io_uring_setup, entries, &p);
+	if (ring->fd < 0)
+		return -1;
+	static const int ops[] = { IORING_OP_OPENAT, IORING_OP_READ };
+	if (!__uring_supports(ring->fd, ops, 2)){
+		close(ring->fd);
+		return -1;
+	}
+
+	ring->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	ring->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP){
+		if (ring->cq_len > ring->sq_len)
+			ring->sq_len = ring->cq_len;
+		ring->cq_len = ring->sq_len;
+	}
+	ring->sq_ptr = mmap(NULL, ring->sq_len, PROT_READ | PROT_WRITE,
+			    MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+	if (ring->sq_ptr == MAP_FAILED)
+		goto error;
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+		ring->cq_ptr = ring->sq_ptr;
+	else
+		ring->cq_ptr = mmap(NULL, ring->cq_len, PROT_READ | PROT_WRITE,
+				    MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+	if (ring->cq_ptr == MAP_FAILED)
+		goto error;
+	ring->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = mmap(NULL, ring->sqes_len, PROT_READ | PROT_WRITE,
+			  MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+	if (ring->sqes == MAP_FAILED)
+		goto error;
+
+	char *sq = ring->sq_ptr, *cq = ring->cq_ptr;
+	ring->sq_head = (unsigned*)(sq + p.sq_off.head);
+	ring->sq_tail = (unsigned*)(sq + p.sq_off.tail);
+	ring->sq_mask = (unsigned*)(sq + p.sq_off.ring_mask);
+	ring->sq_array = (unsigned*)(sq + p.sq_off.array);
+	ring->cq_head = (unsigned*)(cq + p.cq_off.head);
+	ring->cq_tail = (unsigned*)(cq + p.cq_off.tail);
+	ring->cq_mask = (unsigned*)(cq + p.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe*)(cq + p.cq_off.cqes);
+	ring->entries = p.sq_entries;
+	return 0;
+
+error:
+	__uring_exit(ring);
+	return -1;
+}
+
+static struct io_uring_sqe* __uring_get_sqe(struct uring *ring){
+	unsigned index = *ring->sq_tail & *ring->sq_mask;
+	struct io_uring_sqe *sqe = &ring->sqes[index];
+	memset(sqe, 0, sizeof(*sqe));
+	ring->sq_array[index] = index;
+	return sqe;
+}
+
+/* Makes the last sqe returned by __uring_get_sqe visible to the kernel */
+static void __uring_push(struct uring *ring){
+	__atomic_store_n(ring->sq_tail, *ring->sq_tail + 1, __ATOMIC_RELEASE);
+}
+
+/* Per file state, indexed by the user_data of the requests */
+struct load_file {
+	int fd;
+	int in_flight;
+	size_t size;
+	string_t *str;
+};
+
+static void __queue_open(struct uring *ring, const char *path, size_t i){
+	struct io_uring_sqe *sqe = __uring_get_sqe(ring);
+	sqe->opcode = IORING_OP_OPENAT;
+	sqe->fd = AT_FDCWD;
+	sqe->addr = (uintptr_t)path;
+	sqe->open_flags = O_RDONLY | O_CLOEXEC;
+	sqe->user_data = i;
+	__uring_push(ring);
+}
+
+static void __queue_read(struct uring *ring, struct load_file *file, size_t i){
+	struct io_uring_sqe *sqe = __uring_get_sqe(ring);
+	string_t *str = file->str;
+	sqe->opcode = IORING_OP_READ;
+	sqe->fd = file->fd;
+	sqe->addr = (uintptr_t)&str->buffer[str->length];
+	size_t len = file->size - str->length;
+	sqe->len = len < MAX_READ ? len : MAX_READ;
+	sqe->off = str->length;
+	sqe->user_data = i;
+	__uring_push(ring);
+}
+
+static void __finish(struct load_file *file, string_t **out, int ok){
+	if (file->fd >= 0)
+		close(file->fd);
+	file->fd = -1;
+	if (ok){
+		file->str->buffer[file->str->length] = '\0';
+		*out = file->str;
+	} else {
+		str_free(file->str);
+		*out = NULL;
+	}
+	file->str = NULL;
+}
+
+/*
+ * Handles the completion of the request for the i-th file.
+ * @return 1 if the file needs another read, 0 if it's done
+ */
+static int __complete(struct load_file *file, string_t **out, int res){
+	if (!file->str){
+		/* Open */
+		if (res < 0)
+			goto fail;
+		file->fd = res;
+		struct stat st;
+		if (fstat(file->fd, &st) < 0)
+			goto fail;
+		file->str = __str_sized(st.st_size);
+		if (!file->str)
+			goto fail;
+		file->size = st.st_size;
+		if (file->size == 0){
+			__finish(file, out, __read_unsized(file->fd, file->str) == 0);
+			return 0;
+		}
+		return 1;
+	}
+	/* Read */
+	if (res == -EINTR || res == -EAGAIN)
+		return 1;
+	if (res < 0)
+		goto fail;
+	file->str->length += res;
+	if (res == 0 || file->str->length == file->size){
+		__finish(file, out, 1);
+		return 0;
+	}
+	return 1;
+
+fail:
+	__finish(file, out, 0);
+	return 0;
+}
+
+/*
+ * @return the number of files loaded, or -1 if io_uring is not available
+ */
+static long __load_uring(const char **paths, size_t n, string_t **out){
+	struct uring ring;
+	if (__uring_init(&ring, RING_ENTRIES) < 0)
+		return -1;
+	struct load_file *files = malloc(n * sizeof(*files));
+	size_t *ready = malloc(n * sizeof(size_t));
+	/* The file of each sqe, by its index in the submission ring */
+	size_t *sqe_file = malloc(ring.entries * sizeof(size_t));
+	if (!files || !ready || !sqe_file){
+		free(files);
+		free(ready);
+		free(sqe_file);
+		__uring_exit(&ring);
+		return -1;
+	}
+	for (size_t i = 0; i < n; i++){
+		files[i] = (struct load_file){ .fd = -1 };
+		out[i] = NULL;
+	}
+
+	size_t next_open = 0, done = 0, loaded = 0;
+	size_t ready_head = 0, ready_tail = 0;
+	/* queued: in the submission ring, not yet consumed by the kernel */
+	unsigned queued = 0, in_flight = 0;
+	unsigned sent = *ring.sq_tail;
+	int broken = 0;
+	while (done < n){
+		while (in_flight + queued < ring.entries){
+			size_t i;
+			unsigned slot = *ring.sq_tail & *ring.sq_mask;
+			if (ready_head != ready_tail){
+				i = ready[ready_head++ % n];
+				__queue_read(&ring, &files[i], i);
+			} else if (next_open < n){
+				i = next_open++;
+				if (!paths[i]){
+					done++;
+					continue;
+				}
+				__queue_open(&ring, paths[i], i);
+			} else {
+				break;
+			}
+			sqe_file[slot] = i;
+			queued++;
+		}
+		if (in_flight + queued == 0)
+			break;
+		int entered = syscall(__NR_io_uring_enter, ring.fd, queued, 1,
+				      IORING_ENTER_GETEVENTS, NULL, 0);
+		if (entered < 0){
+			if (errno == EINTR)
+				continue;
+			broken = 1;
+			break;
+		}
+		/* The kernel consumes the sqes in order, and only the ones it
+		 * consumed can be in flight */
+		for (int k = 0; k < entered; k++)
+			files[sqe_file[sent++ & *ring.sq_mask]].in_flight = 1;
+		queued -= entered;
+		in_flight += entered;
+
+		unsigned head = *ring.cq_head;
+		unsigned tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+		for (; head != tail; head++){
+			struct io_uring_cqe *cqe = &ring.cqes[head & *ring.cq_mask];
+			size_t i = cqe->user_data;
+			in_flight--;
+			files[i].in_flight = 0;
+			if (__complete(&files[i], &out[i], cqe->res)){
+				ready[ready_tail++ % n] = i;
+			} else {
+				done++;
+				if (out[i])
+					loaded++;
+			}
+		}
+		__atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+	}
+
+	if (broken){
+		/* The kernel may still write to the buffers of the requests
+		 * in flight, so those are leaked instead of freed. */
+		for (size_t i = 0; i < n; i++){
+			if (!files[i].in_flight && (files[i].str || files[i].fd >= 0))
+				__finish(&files[i], &out[i], 0);
+			str_free(out[i]);
+			out[i] = NULL;
+		}
+	}
+	free(files);
+	free(ready);
+	free(sqe_file);
+	__uring_exit(&ring);
+	return broken ? -1 : (long)loaded;
+}
+
+#endif // HAVE_IO_URING
+
+size_t str_load_files(const char **paths, size_t n, string_t **out){
+	if (!paths || !out || n == 0)
+		return 0;
+#ifdef HAVE_IO_URING
+	long loaded = __load_uring(paths, n, out);
+	if (loaded >= 0)
+		return loaded;
+#endif
+	return __load_threaded(paths, n, out);
+}
@@ -0,0 +1,347 @@
+/*
+ * parse.c - Number parsing from string_t ranges.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * The numbers are parsed straight from the buffer of the string_t, without
+ * needing a NULL terminator. Runs of 8 digits are converted at once (SWAR),
+ * and floats go through the Clinger fast path or the Eisel-Lemire algorithm,
+ * falling back to strtod only for the rare cases those can't decide.
+ */
+#define _GNU_SOURCE // strtod_l
+#include "str.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h> // memcpy
+#include <math.h>   // INFINITY, NAN
+#include <locale.h> // newlocale
+#include "util.h"
+#include "internal.h"
+#include "pow10.h"
+
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SWAR_DIGITS
+#endif
+
+#define MAX_EXP10 100000
+#define STACK_BUF_SIZE 128
+
+/*
+ * strtod in the "C" locale, so the decimal point is always '.'
+ * whatever LC_NUMERIC says. The locale is built once and shared.
+ */
+static double __strtod_c(const char *buf){
+	static locale_t c_locale;
+	locale_t loc = __atomic_load_n(&c_locale, __ATOMIC_ACQUIRE);
+	if (!loc){
+		locale_t fresh = newlocale(LC_ALL_MASK, "C", (locale_t)0);
+		if (!fresh)
+			return strtod(buf, NULL);
+		if (__atomic_compare_exchange_n(&c_locale, &loc, fresh, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			loc = fresh;
+		else
+			freelocale(fresh);
+	}
+	return strtod_l(buf, NULL, loc);
+}
+
+#ifdef SWAR_DIGITS
+static INLINE int __is_8digits(uint64_t v){
+	return ((v & 0xF0F0F0F0F0F0F0F0) |
+		(((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+		== 0x3333333333333333;
+}
+
+static INLINE uint32_t __parse_8digits(uint64_t v){
+	v -= 0x3030303030303030;
+	v = (v * 10) + (v >> 8);
+	v = (((v & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+	     (((v >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+	return (uint32_t)v;
+}
+#endif
+
+static INLINE int __get_range(const string_t *str, unsigned start, unsigned *end){
+	if (*end > str->length)
+		*end = str->length;
+	return start <= *end;
+}
+
+/*
+ * Parses a run of digits into *out.
+ * @return the number of digits consumed, or -1 on overflow
+ */
+static long __parse_u64(const char *p, size_t n, uint64_t *out){
+	uint64_t v = 0;
+	size_t i = 0;
+#ifdef SWAR_DIGITS
+	/* Two blocks can't overflow: 16 digits < 2^64 */
+	for (int block = 0; block < 2 && i + 8 <= n; block++){
+		uint64_t chunk;
+		memcpy(&chunk, &p[i], sizeof(chunk));
+		if (!__is_8digits(chunk))
+			break;
+		v = v * 100000000 + __parse_8digits(chunk);
+		i += 8;
+	}
+#endif
+	for (; i < n; i++){
+		unsigned d = (unsigned char)p[i] - '0';
+		if (d > 9)
+			break;
+		if (v > (UINT64_MAX - d) / 10)
+			return -1;
+		v = v * 10 + d;
+	}
+	*out = v;
+	return i;
+}
+
+int str_parse_u64(const string_t *str, unsigned start, unsigned end, uint64_t *out){
+	if (!str || !out)
+		return -1;
+	if (!__get_range(str, start, &end))
+		return -2;
+	const char *p = &str->buffer[start];
+	size_t n = end - start, i = 0;
+	if (i < n && p[i] == '+')
+		i++;
+	uint64_t v;
+	long digits = __parse_u64(&p[i], n - i, &v);
+	if (digits < 0)
+		return -4;
+	if (digits == 0)
+		return -3;
+	*out = v;
+	return i + digits;
+}
+
+int str_parse_i64(const string_t *str, unsigned start, unsigned end, int64_t *out){
+	if (!str || !out)
+		return -1;
+	if (!__get_range(str, start, &end))
+		return -2;
+	const char *p = &str->buffer[start];
+	size_t n = end - start, i = 0;
+	int neg = 0;
+	if (i < n && (p[i] == '+' || p[i] == '-'))
+		neg = p[i++] == '-';
+	uint64_t v;
+	long digits = __parse_u64(&p[i], n - i, &v);
+	if (digits < 0)
+		return -4;
+	if (digits == 0)
+		return -3;
+	if (neg){
+		if (v > (uint64_t)INT64_MAX + 1)
+			return -4;
+		*out = v == (uint64_t)INT64_MAX + 1 ? INT64_MIN : -(int64_t)v;
+	} else {
+		if (v > INT64_MAX)
+			return -4;
+		*out = v;
+	}
+	return i + digits;
+}
+
+/*
+ * Consumes a run of digits, keeping up to 19 significant ones in *m.
+ * @param nd number of significant digits already in *m
+ * @param dropped incremented for each significant digit that didn't fit
+ * @return the number of digits consumed
+ */
+static size_t __eat_digits(const char *p, size_t n, uint64_t *m, int *nd, size_t *dropped){
+	size_t i = 0;
+	if (*nd == 0){
+		while (i < n && p[i] == '0')
+			i++;
+	}
+#ifdef SWAR_DIGITS
+	while (*nd <= 11 && i + 8 <= n){
+		uint64_t chunk;
+		memcpy(&chunk, &p[i], sizeof(chunk));
+		if (!__is_8digits(chunk))
+			break;
+		*m = *m * 100000000 + __parse_8digits(chunk);
+		*nd += 8;
+		i += 8;
+	}
+#endif
+	for (; i < n; i++){
+		unsigned d = (unsigned char)p[i] - '0';
+		if (d > 9)
+			break;
+		if (*nd < 19){
+			*m = *m * 10 + d;
+			(*nd)++;
+		} else {
+			(*dropped)++;
+		}
+	}
+	return i;
+}
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 uint128_t;
+
+/*
+ * Eisel-Lemire: computes m * 10^exp10 rounded to the nearest double.
+ * @return 0 if the result can't be decided with 128 bits of precision
+ */
+static int __eisel_lemire(uint64_t m, int64_t exp10, int neg, double *out){
+	if (exp10 < POW10_MIN_EXP || exp10 > POW10_MAX_EXP)
+		return 0;
+	const uint64_t *pow = __pow10_128[exp10 - POW10_MIN_EXP];
+	int clz = __builtin_clzll(m);
+	m <<= clz;
+	uint64_t exp2 = (uint64_t)(((217706 * exp10) >> 16) + 64 + 1023) - clz;
+
+	uint128_t x = (uint128_t)m * pow[0];
+	uint64_t hi = x >> 64, lo = (uint64_t)x;
+	if ((hi & 0x1FF) == 0x1FF && lo + m < m){
+		uint128_t y = (uint128_t)m * pow[1];
+		uint64_t y_hi = y >> 64, y_lo = (uint64_t)y;
+		uint64_t merged_hi = hi, merged_lo = lo + y_hi;
+		if (merged_lo < lo)
+			merged_hi++;
+		if ((merged_hi & 0x1FF) == 0x1FF && merged_lo + 1 == 0 && y_lo + m < m)
+			return 0;
+		hi = merged_hi;
+		lo = merged_lo;
+	}
+
+	uint64_t msb = hi >> 63;
+	uint64_t mantissa = hi >> (msb + 9);
+	exp2 -= 1 ^ msb;
+	if (lo == 0 && (hi & 0x1FF) == 0 && (mantissa & 3) == 1)
+		return 0;
+	mantissa += mantissa & 1;
+	mantissa >>= 1;
+	if (mantissa >> 53){
+		mantissa >>= 1;
+		exp2++;
+	}
+	/* Subnormals, infinities and NaNs are left for strtod */
+	if (exp2 - 1 >= 0x7FF - 1)
+		return 0;
+	uint64_t bits = exp2 << 52 | (mantissa & 0x000FFFFFFFFFFFFF);
+	if (neg)
+		bits |= 0x8000000000000000;
+	memcpy(out, &bits, sizeof(*out));
+	return 1;
+}
+#endif
+
+static const double __exact_pow10[] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+	1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+	1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static int __compute_float(uint64_t m, int64_t exp10, int neg, int truncated, double *out){
+	if (m == 0){
+		*out = neg ? -0.0 : 0.0;
+		return 1;
+	}
+	/* Clinger: both m and 10^|exp10| are exact doubles */
+	if (!truncated && m <= (1ULL << 53) && exp10 >= -22 && exp10 <= 22){
+		double d = (double)m;
+		d = exp10 < 0 ? d / __exact_pow10[-exp10] : d * __exact_pow10[exp10];
+		*out = neg ? -d : d;
+		return 1;
+	}
+#ifdef __SIZEOF_INT128__
+	if (!truncated)
+		return __eisel_lemire(m, exp10, neg, out);
+	/* The real mantissa is in (m, m + 1), if both round the same we're done */
+	double lower, upper;
+	if (m < UINT64_MAX &&
+	    __eisel_lemire(m, exp10, neg, &lower) &&
+	    __eisel_lemire(m + 1, exp10, neg, &upper) &&
+	    lower == upper){
+		*out = lower;
+		return 1;
+	}
+#endif
+	return 0;
+}
+
+static size_t __match_word(const char *p, size_t n, const char *word){
+	size_t i = 0;
+	for (; word[i] != '\0'; i++){
+		if (i >= n || (p[i] | 0x20) != word[i])
+			return 0;
+	}
+	return i;
+}
+
+int str_parse_f64(const string_t *str, unsigned start, unsigned end, double *out){
+	if (!str || !out)
+		return -1;
+	if (!__get_range(str, start, &end))
+		return -2;
+	const char *p = &str->buffer[start];
+	size_t n = end - start, i = 0;
+	int neg = 0;
+	if (i < n && (p[i] == '+' || p[i] == '-'))
+		neg = p[i++] == '-';
+
+	size_t word;
+	if ((word = __match_word(&p[i], n - i, "infinity")) ||
+	    (word = __match_word(&p[i], n - i, "inf"))){
+		*out = neg ? -INFINITY : INFINITY;
+		return i + word;
+	}
+	if ((word = __match_word(&p[i], n - i, "nan"))){
+		*out = neg ? -NAN : NAN;
+		return i + word;
+	}
+
+	uint64_t m = 0;
+	int nd = 0;
+	size_t dropped = 0;
+	int64_t exp10 = 0;
+	size_t int_digits = __eat_digits(&p[i], n - i, &m, &nd, &dropped);
+	i += int_digits;
+	exp10 += dropped;
+	size_t frac_digits = 0;
+	if (i < n && p[i] == '.'){
+		size_t frac_dropped = 0;
+		frac_digits = __eat_digits(&p[i + 1], n - i - 1, &m, &nd, &frac_dropped);
+		exp10 -= frac_digits - frac_dropped;
+		dropped += frac_dropped;
+		if (int_digits > 0 || frac_digits > 0)
+			i += 1 + frac_digits;
+	}
+	if (int_digits == 0 && frac_digits == 0)
+		return -3;
+
+	if (i < n && (p[i] | 0x20) == 'e'){
+		size_t j = i + 1;
+		int exp_neg = 0;
+		if (j < n && (p[j] == '+' || p[j] == '-'))
+			exp_neg = p[j++] == '-';
+		if (j < n && (unsigned)(p[j] - '0') <= 9){
+			int64_t e = 0;
+			for (; j < n && (unsigned)(p[j] - '0') <= 9; j++){
+				if (e < MAX_EXP10)
+					e = e * 10 + (p[j] - '0');
+			}
+			exp10 += exp_neg ? -e : e;
+			i = j;
+		}
+	}
+
+	if (__compute_float(m, exp10, neg, dropped > 0, out))
+		return i;
+
+	char stack_buf[STACK_BUF_SIZE];
+	char *buf = i < sizeof(stack_buf) ? stack_buf : malloc(i + 1);
+	if (!buf)
+		return -1;
+	memcpy(buf, p, i);
+	buf[i] = '\0';
+	*out = __strtod_c(buf);
+	if (buf != stack_buf)
+		free(buf);
+	return i;
+}
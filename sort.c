@@ -0,0 +1,326 @@
+/*
+ * sort.c - Bulk sorting of string_t and wstring_t arrays.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * The arrays are sorted with a multikey quicksort over a contiguous
+ * array of items, each one caching the next 8 bytes (or 2 wchar_t)
+ * of its string as a big endian integer. Partitioning only looks at
+ * the cached keys, and the strings are only read again when a group
+ * of items shares the same key and needs the following chunk.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str.h"
+#include "wstr.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memcpy, memcmp
+#include <wchar.h>  // wmemcmp
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h> // sysconf
+#include "util.h"
+#include "internal.h"
+
+#define INSERTION_THRESHOLD 16
+#define PARALLEL_THRESHOLD (1 << 16)
+#define N_BUCKETS 256
+
+#define KEY_CHARS(wide) ((wide) ? 2 : 8)
+
+/*
+ * buf holds len characters of char_size bytes each. The buffers of
+ * compact wstring_ts are read as they are, without their wide copy.
+ */
+struct sort_item {
+	uint64_t      key;
+	size_t        len;
+	const void   *buf;
+	void         *s;
+	unsigned char char_size;
+};
+
+static INLINE uint64_t __load_be64(const unsigned char *p){
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	uint64_t v;
+	memcpy(&v, p, sizeof(v));
+	return __builtin_bswap64(v);
+#else
+	uint64_t v = 0;
+	for (int i = 0; i < 8; i++)
+		v = v << 8 | p[i];
+	return v;
+#endif
+}
+
+/*
+ * Caches the chars in [depth, depth + KEY_CHARS) of the item.
+ * Missing chars are padded with 0, the smallest possible value, and
+ * the tie with a real 0 char is broken by length (see __take_finished)
+ */
+static INLINE void __fill_key(struct sort_item *it, size_t depth, int wide){
+	uint64_t key = 0;
+	if (wide){
+		for (size_t i = 0; i < 2; i++){
+			key <<= 32;
+			if (depth + i < it->len)
+				key |= (uint32_t)__wchar_at(it->buf, depth + i, it->char_size) ^ 0x80000000u;
+		}
+	} else {
+		const unsigned char *buf = it->buf;
+		if (depth + 8 <= it->len){
+			key = __load_be64(&buf[depth]);
+		} else {
+			for (size_t i = 0; i < 8; i++){
+				key <<= 8;
+				if (depth + i < it->len)
+					key |= buf[depth + i];
+			}
+		}
+	}
+	it->key = key;
+}
+
+static INLINE void __swap(struct sort_item *a, struct sort_item *b){
+	struct sort_item tmp = *a;
+	*a = *b;
+	*b = tmp;
+}
+
+/*
+ * Compares the characters in [from, to) of two wide items
+ */
+static int __wide_cmp(const struct sort_item *a, const struct sort_item *b, size_t from, size_t to){
+	if (a->char_size == sizeof(wchar_t) && b->char_size == sizeof(wchar_t))
+		return wmemcmp((const wchar_t*)a->buf + from, (const wchar_t*)b->buf + from, to - from);
+	for (size_t i = from; i < to; i++){
+		wchar_t ca = __wchar_at(a->buf, i, a->char_size);
+		wchar_t cb = __wchar_at(b->buf, i, b->char_size);
+		if (ca != cb)
+			return ca < cb ? -1 : 1;
+	}
+	return 0;
+}
+
+/*
+ * Full comparison of two items that share the prefix [0, depth)
+ */
+static int __item_cmp(const struct sort_item *a, const struct sort_item *b, size_t depth, int wide){
+	if (a->key != b->key)
+		return a->key < b->key ? -1 : 1;
+	size_t min = a->len < b->len ? a->len : b->len;
+	depth += KEY_CHARS(wide);
+	if (depth < min){
+		int c = wide ? __wide_cmp(a, b, depth, min)
+			     : memcmp((const char*)a->buf + depth, (const char*)b->buf + depth, min - depth);
+		if (c != 0)
+			return c;
+	}
+	return (a->len > b->len) - (a->len < b->len);
+}
+
+static void __insertion_sort(struct sort_item *v, size_t n, size_t depth, int wide){
+	for (size_t i = 1; i < n; i++){
+		struct sort_item tmp = v[i];
+		size_t j = i;
+		while (j > 0 && __item_cmp(&tmp, &v[j - 1], depth, wide) < 0){
+			v[j] = v[j - 1];
+			j--;
+		}
+		v[j] = tmp;
+	}
+}
+
+static INLINE uint64_t __median3(uint64_t a, uint64_t b, uint64_t c){
+	if (a < b){
+		if (b < c) return b;
+		return a < c ? c : a;
+	}
+	if (a < c) return a;
+	return b < c ? c : b;
+}
+
+/*
+ * Moves the items that end before limit to the front of v, ordered
+ * by length. Since all of them share the same key, each one is a
+ * prefix of the ones after it.
+ * @return the number of items moved
+ */
+static size_t __take_finished(struct sort_item *v, size_t n, size_t depth, size_t limit){
+	size_t done = 0;
+	for (size_t l = depth; l <= limit; l++){
+		for (size_t i = done; i < n; i++){
+			if (v[i].len <= l)
+				__swap(&v[done++], &v[i]);
+		}
+	}
+	return done;
+}
+
+static void __mkqsort(struct sort_item *v, size_t n, size_t depth, int wide){
+	while (n > INSERTION_THRESHOLD){
+		uint64_t pivot = __median3(v[0].key, v[n / 2].key, v[n - 1].key);
+		size_t lt = 0, i = 0, gt = n;
+		while (i < gt){
+			if (v[i].key < pivot)
+				__swap(&v[lt++], &v[i++]);
+			else if (v[i].key > pivot)
+				__swap(&v[i], &v[--gt]);
+			else
+				i++;
+		}
+
+		/* The items equal to the pivot go on with the next chunk */
+		struct sort_item *eq = &v[lt];
+		size_t n_eq = gt - lt;
+		size_t next = depth + KEY_CHARS(wide);
+		size_t done = __take_finished(eq, n_eq, depth, next);
+		eq += done;
+		n_eq -= done;
+		for (size_t j = 0; j < n_eq; j++)
+			__fill_key(&eq[j], next, wide);
+
+		/*
+		 * Only the two smaller parts are sorted recursively, each one
+		 * at most half of v, so the stack depth stays logarithmic
+		 */
+		struct { struct sort_item *v; size_t n, depth; } part[3] = {
+			{ v, lt, depth }, { eq, n_eq, next }, { &v[gt], n - gt, depth }
+		};
+		int big = 0;
+		for (int k = 1; k < 3; k++){
+			if (part[k].n > part[big].n)
+				big = k;
+		}
+		for (int k = 0; k < 3; k++){
+			if (k != big)
+				__mkqsort(part[k].v, part[k].n, part[k].depth, wide);
+		}
+		v = part[big].v;
+		n = part[big].n;
+		depth = part[big].depth;
+	}
+	__insertion_sort(v, n, depth, wide);
+}
+
+struct sort_job {
+	struct sort_item *items;
+	size_t bounds[N_BUCKETS + 1];
+	atomic_size_t next;
+	int wide;
+};
+
+static void* __sort_worker(void *arg){
+	struct sort_job *job = arg;
+	size_t b;
+	while ((b = atomic_fetch_add(&job->next, 1)) < N_BUCKETS){
+		size_t start = job->bounds[b], end = job->bounds[b + 1];
+		__mkqsort(&job->items[start], end - start, 0, job->wide);
+	}
+	return NULL;
+}
+
+/*
+ * Distributes the items into buckets by the 8 most significant bits
+ * in which their keys differ, so that the buckets are already in order,
+ * and sorts the buckets in parallel.
+ * @return 0 if the keys can't be split (they're all equal)
+ */
+static int __parallel_sort(struct sort_item *items, size_t n, unsigned n_threads, int wide){
+	uint64_t diff = 0;
+	for (size_t i = 1; i < n; i++)
+		diff |= items[i].key ^ items[0].key;
+	if (diff == 0)
+		return 0;
+	int high = 63;
+	while (!(diff >> high))
+		high--;
+	int shift = high >= 7 ? high - 7 : 0;
+
+	struct sort_item *tmp = malloc(n * sizeof(*tmp));
+	if (!tmp)
+		return 0;
+	struct sort_job job = { .items = tmp, .wide = wide };
+	size_t count[N_BUCKETS] = {0};
+	for (size_t i = 0; i < n; i++)
+		count[(items[i].key >> shift) & 0xFF]++;
+	job.bounds[0] = 0;
+	for (size_t b = 0; b < N_BUCKETS; b++)
+		job.bounds[b + 1] = job.bounds[b] + count[b];
+	for (size_t b = 0; b < N_BUCKETS; b++)
+		count[b] = job.bounds[b];
+	for (size_t i = 0; i < n; i++)
+		tmp[count[(items[i].key >> shift) & 0xFF]++] = items[i];
+	atomic_init(&job.next, 0);
+
+	pthread_t *threads = malloc((n_threads - 1) * sizeof(pthread_t));
+	unsigned spawned = 0;
+	if (threads){
+		while (spawned < n_threads - 1 &&
+		       pthread_create(&threads[spawned], NULL, __sort_worker, &job) == 0)
+			spawned++;
+	}
+	__sort_worker(&job);
+	for (unsigned t = 0; t < spawned; t++)
+		pthread_join(threads[t], NULL);
+	free(threads);
+
+	memcpy(items, tmp, n * sizeof(*items));
+	free(tmp);
+	return 1;
+}
+
+static void __sort_items(struct sort_item *items, size_t n, unsigned n_threads, int wide){
+	if (n_threads == 0){
+		long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		n_threads = n_cpus > 0 ? n_cpus : 1;
+	}
+	if (n_threads > 1 && n >= PARALLEL_THRESHOLD
+	    && __parallel_sort(items, n, n_threads, wide))
+		return;
+	__mkqsort(items, n, 0, wide);
+}
+
+void str_sort_parallel(string_t **arr, size_t n, unsigned n_threads){
+	if (!arr || n < 2)
+		return;
+	struct sort_item *items = malloc(n * sizeof(*items));
+	assert(items);
+	for (size_t i = 0; i < n; i++){
+		items[i].s = arr[i];
+		items[i].buf = arr[i] ? arr[i]->buffer : NULL;
+		items[i].len = arr[i] ? arr[i]->length : 0;
+		items[i].char_size = 1;
+		__fill_key(&items[i], 0, 0);
+	}
+	__sort_items(items, n, n_threads, 0);
+	for (size_t i = 0; i < n; i++)
+		arr[i] = items[i].s;
+	free(items);
+}
+
+void str_sort(string_t **arr, size_t n){
+	str_sort_parallel(arr, n, 1);
+}
+
+void wstr_sort_parallel(wstring_t **arr, size_t n, unsigned n_threads){
+	if (!arr || n < 2)
+		return;
+	struct sort_item *items = malloc(n * sizeof(*items));
+	assert(items);
+	for (size_t i = 0; i < n; i++){
+		items[i].s = arr[i];
+		items[i].buf = arr[i] ? arr[i]->buffer : NULL;
+		items[i].len = arr[i] ? arr[i]->length : 0;
+		items[i].char_size = arr[i] ? arr[i]->char_size : sizeof(wchar_t);
+		__fill_key(&items[i], 0, 1);
+	}
+	__sort_items(items, n, n_threads, 1);
+	for (size_t i = 0; i < n; i++)
+		arr[i] = items[i].s;
+	free(items);
+}
+
+void wstr_sort(wstring_t **arr, size_t n){
+	wstr_sort_parallel(arr, n, 1);
+}
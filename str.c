@@ -8,7 +8,11 @@
 #include <assert.h>
 #include <string.h> // memcpy, strnlen
 #include <stdarg.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "util.h"
+#include "internal.h"
 
 #define INITIAL_SIZE 16
 #ifndef GROW_FACTOR
@@ -16,28 +20,23 @@
 #endif
 static_assert(GROW_FACTOR > 1, "");
 
-struct string {
-        char    *buffer;
-        size_t  length;
-        size_t  buffer_size;
-};
-
+/*
+ * The buffer always has room for one more char than buffer_size,
+ * and buffer[length] is always '\0'. Every function that changes
+ * the length must keep that invariant, so str_get_buffer never
+ * needs to modify the string.
+ */
 static void resize_buffer(string_t *str, size_t new_size){
 	if (new_size == 0)
 		new_size = 1;
 	str->buffer_size = new_size;
-	str->buffer = realloc(str->buffer, str->buffer_size * sizeof(char));
+	str->buffer = realloc(str->buffer, (str->buffer_size + 1) * sizeof(char));
 	assert(str->buffer);
 }
 
 static INLINE
 string_t* __str_init(unsigned int initial_size) {
-	string_t *str = malloc(sizeof(*str));
-	assert(str);
-	str->buffer = NULL;
-	resize_buffer(str, initial_size);
-	str->length = 0;
-	return str;
+	return __str_init_sized(initial_size);
 }
 
 string_t* str_empty(void){
@@ -73,7 +72,9 @@ int str_concat_cstr(string_t *str, const char *cat, unsigned n){
 		resize_buffer(str, new_size);
 	}
         memcpy(&str->buffer[str->length], cat, len * sizeof(char));
+	__str_modified(str, str->length);
 	str->length += len;
+	str->buffer[str->length] = '\0';
 	return 1;
 }
 
@@ -83,8 +84,14 @@ int str_concat_str(string_t *str, string_t *cat){
 	return str_concat_cstr(str, cat->buffer, cat->length);
 }
 
-int str_push_char(string_t *str, char c){
-	return str_concat_cstr(str, (char[]){c,'\0'}, 2);
+int (str_push_char)(string_t *str, char c){
+	if (!str)
+		return -1;
+	if (str->length == str->buffer_size)
+		resize_buffer(str, str->buffer_size * GROW_FACTOR);
+	str->buffer[str->length++] = c;
+	str->buffer[str->length] = '\0';
+	return 1;
 }
 
 int str_pop(string_t *str){
@@ -100,24 +107,28 @@ int str_remove_at(string_t *str, unsigned index){
 		return -2;
 	if (index < str->length - 1)
 		memcpy(&str->buffer[index], &str->buffer[index + 1], (str->length - index - 1) * sizeof(char));
+	__str_modified(str, index);
 	str->length--;
+	str->buffer[str->length] = '\0';
 	return 1;
 }
 
 int str_remove_range(string_t *str, unsigned start, unsigned end){
 	if (!str)
 		return -1;
-	if (end < start)
+	if (end < start || start > str->length)
 		return -2;
 	if (end > str->length)
 		end = str->length;
 	size_t len = str->length - end;
 	memmove(&str->buffer[start], &str->buffer[end], len * sizeof(char));
+	__str_modified(str, start);
 	str->length -= end - start;
+	str->buffer[str->length] = '\0';
 	return 1;
 }
 
-char str_get_at(string_t *str, unsigned index){
+char (str_get_at)(string_t *str, unsigned index){
 	if (!str)
 		return -1;
 	else if (index >= str->length)
@@ -125,11 +136,12 @@ char str_get_at(string_t *str, unsigned index){
 	return str->buffer[index];
 }
 
-int str_set_at(string_t *str, unsigned index, char c){
+int (str_set_at)(string_t *str, unsigned index, char c){
 	if (!str)
 		return -1;
 	else if (index >= str->length)
 		return -2;
+	__str_modified(str, index);
 	return str->buffer[index] = c;
 }
 
@@ -147,7 +159,9 @@ int str_insert_cstr(string_t *str, const char *insert, unsigned n, unsigned inde
 	}
 	memmove(&str->buffer[index + len], &str->buffer[index], (str->length - index) * sizeof(char));
 	memcpy(&str->buffer[index], insert, len * sizeof(char));
+	__str_modified(str, index);
 	str->length += len;
+	str->buffer[str->length] = '\0';
 	return 1;
 }
 
@@ -164,12 +178,9 @@ char* str_to_cstr(string_t *str){
 	return cstr;
 }
 
-const char* str_get_buffer(string_t *str){
+const char* (str_get_buffer)(const string_t *str){
 	if (!str)
 		return NULL;
-	if (str->length == str->buffer_size)
-		resize_buffer(str, str->buffer_size * GROW_FACTOR);
-	str->buffer[str->length] = '\0';
 	return str->buffer;
 }
 
@@ -191,6 +202,7 @@ int str_transform(string_t *str, char(*func)(char)){
 		return -1;
 	for (size_t i = 0; i < str->length; i++)
 		str->buffer[i] = func(str->buffer[i]);
+	__str_modified(str, 0);
 	return 1;
 }
 
@@ -198,17 +210,175 @@ string_t* str_dup(string_t *str){
 	if (!str)
 		return NULL;
 	string_t *dup = str_init(str->length);
-	memcpy(dup->buffer, str->buffer, str->length * sizeof(char));
+	memcpy(dup->buffer, str->buffer, (str->length + 1) * sizeof(char));
         dup->length = str->length;
 	return dup;
 }
 
-size_t str_length(string_t *str){
+size_t (str_length)(string_t *str){
 	if (!str)
 		return 0;
 	return str->length;
 }
 
+str_view_t str_as_view(const string_t *str){
+	if (!str)
+		return (str_view_t){ .buf = "", .len = 0 };
+	return (str_view_t){ .buf = str->buffer, .len = str->length };
+}
+
+static INLINE str_view_t __cstr_view(const char *cstr){
+	if (!cstr)
+		return (str_view_t){ .buf = "", .len = 0 };
+	return (str_view_t){ .buf = cstr, .len = strlen(cstr) };
+}
+
+static INLINE unsigned char __ascii_lower(unsigned char c){
+	return (c >= 'A' && c <= 'Z') ? c | 0x20 : c;
+}
+
+/*
+ * Compares n bytes of a and b, ignoring ASCII case.
+ * The SSE2 loop lowercases 16 bytes of each side at a time and bails
+ * out to the scalar loop on the first block that differs.
+ */
+static int __casecmp_n(const char *a, const char *b, size_t n){
+	size_t i = 0;
+#ifdef __SSE2__
+	const __m128i before_a = _mm_set1_epi8('A' - 1);
+	const __m128i after_z = _mm_set1_epi8('Z' + 1);
+	const __m128i case_bit = _mm_set1_epi8(0x20);
+	for (; i + 16 <= n; i += 16){
+		__m128i x = _mm_loadu_si128((const __m128i*)&a[i]);
+		__m128i y = _mm_loadu_si128((const __m128i*)&b[i]);
+		__m128i xu = _mm_and_si128(_mm_cmpgt_epi8(x, before_a), _mm_cmplt_epi8(x, after_z));
+		__m128i yu = _mm_and_si128(_mm_cmpgt_epi8(y, before_a), _mm_cmplt_epi8(y, after_z));
+		x = _mm_or_si128(x, _mm_and_si128(xu, case_bit));
+		y = _mm_or_si128(y, _mm_and_si128(yu, case_bit));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF)
+			break;
+	}
+#endif
+	for (; i < n; i++){
+		int c = __ascii_lower(a[i]) - __ascii_lower(b[i]);
+		if (c != 0)
+			return c;
+	}
+	return 0;
+}
+
+static int __cmp(str_view_t a, str_view_t b, int nocase){
+	size_t min = a.len < b.len ? a.len : b.len;
+	int c = nocase ? __casecmp_n(a.buf, b.buf, min)
+		       : memcmp(a.buf, b.buf, min * sizeof(char));
+	if (c != 0)
+		return c;
+	return (a.len > b.len) - (a.len < b.len);
+}
+
+static INLINE int __eq(str_view_t a, str_view_t b, int nocase){
+	if (a.len != b.len)
+		return 0;
+	if (nocase)
+		return __casecmp_n(a.buf, b.buf, a.len) == 0;
+	return memcmp(a.buf, b.buf, a.len * sizeof(char)) == 0;
+}
+
+static INLINE int __starts_with(str_view_t s, str_view_t prefix, int nocase){
+	if (prefix.len > s.len)
+		return 0;
+	s.len = prefix.len;
+	return __eq(s, prefix, nocase);
+}
+
+static INLINE int __ends_with(str_view_t s, str_view_t suffix, int nocase){
+	if (suffix.len > s.len)
+		return 0;
+	s.buf += s.len - suffix.len;
+	s.len = suffix.len;
+	return __eq(s, suffix, nocase);
+}
+
+int str_cmp(const string_t *str, const string_t *other){
+	return __cmp(str_as_view(str), str_as_view(other), 0);
+}
+
+int str_cmp_cstr(const string_t *str, const char *cstr){
+	return __cmp(str_as_view(str), __cstr_view(cstr), 0);
+}
+
+int str_cmp_view(const string_t *str, str_view_t view){
+	return __cmp(str_as_view(str), view, 0);
+}
+
+int str_casecmp(const string_t *str, const string_t *other){
+	return __cmp(str_as_view(str), str_as_view(other), 1);
+}
+
+int str_casecmp_cstr(const string_t *str, const char *cstr){
+	return __cmp(str_as_view(str), __cstr_view(cstr), 1);
+}
+
+int str_casecmp_view(const string_t *str, str_view_t view){
+	return __cmp(str_as_view(str), view, 1);
+}
+
+int str_eq(const string_t *str, const string_t *other){
+	return __eq(str_as_view(str), str_as_view(other), 0);
+}
+
+int str_eq_cstr(const string_t *str, const char *cstr){
+	return __eq(str_as_view(str), __cstr_view(cstr), 0);
+}
+
+int str_eq_view(const string_t *str, str_view_t view){
+	return __eq(str_as_view(str), view, 0);
+}
+
+int str_caseeq(const string_t *str, const string_t *other){
+	return __eq(str_as_view(str), str_as_view(other), 1);
+}
+
+int str_caseeq_cstr(const string_t *str, const char *cstr){
+	return __eq(str_as_view(str), __cstr_view(cstr), 1);
+}
+
+int str_caseeq_view(const string_t *str, str_view_t view){
+	return __eq(str_as_view(str), view, 1);
+}
+
+int str_starts_with(const string_t *str, const char *prefix){
+	return __starts_with(str_as_view(str), __cstr_view(prefix), 0);
+}
+
+int str_starts_with_view(const string_t *str, str_view_t prefix){
+	return __starts_with(str_as_view(str), prefix, 0);
+}
+
+int str_ends_with(const string_t *str, const char *suffix){
+	return __ends_with(str_as_view(str), __cstr_view(suffix), 0);
+}
+
+int str_ends_with_view(const string_t *str, str_view_t suffix){
+	return __ends_with(str_as_view(str), suffix, 0);
+}
+
+int str_case_starts_with(const string_t *str, const char *prefix){
+	return __starts_with(str_as_view(str), __cstr_view(prefix), 1);
+}
+
+int str_case_starts_with_view(const string_t *str, str_view_t prefix){
+	return __starts_with(str_as_view(str), prefix, 1);
+}
+
+int str_case_ends_with(const string_t *str, const char *suffix){
+	return __ends_with(str_as_view(str), __cstr_view(suffix), 1);
+}
+
+int str_case_ends_with_view(const string_t *str, str_view_t suffix){
+	return __ends_with(str_as_view(str), suffix, 1);
+}
+
 char* str_tok(string_t *str, char *tokens){
 	static char *prev_tok = NULL;
 	static size_t pos = 0;
@@ -309,12 +479,18 @@ void str_shrink(string_t *str){
 }
 
 void str_clear(string_t *str){
-	if (str)
+	if (str){
+		__str_modified(str, 0);
 		str->length = 0;
+		str->buffer[0] = '\0';
+	}
 }
 
 static INLINE void __str__free(string_t *str) {
 	if (str){
+		if (str->utf8)
+			free(str->utf8->marks);
+		free(str->utf8);
 		free(str->buffer);
 		free(str);
 	}
@@ -7,9 +7,23 @@
 #define STR_H
 
 #include <stddef.h> // size_t
+#include <stdint.h> // int64_t, uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 typedef struct string string_t;
 
+/**
+ * Non-owning view of a sequence of chars.
+ * @note The buffer is not necessarily NULL terminated.
+ */
+typedef struct {
+        const char *buf;
+        size_t      len;
+} str_view_t;
+
 /**
  * Builds an empty string_t
  */
@@ -47,7 +61,8 @@ int str_concat_cstr(string_t *str, const char *cat, unsigned n);
 int str_concat_str(string_t *str, string_t *cat);
 
 /**
- * Puts a char at the end of the string_t
+ * Puts a char at the end of the string_t.
+ * Any char can be pushed, including '\0'.
  */
 int str_push_char(string_t *str, char c);
 
@@ -62,7 +77,10 @@ int str_pop(string_t *str);
 int str_remove_at(string_t *str, unsigned index);
 
 /**
- * Removes the range [start, end) from the string_t
+ * Removes the range [start, end) from the string_t.
+ * end is clamped to the length of the string.
+ * @return 1 on success, -1 if str is NULL,
+ *         -2 if end < start or start is out of bounds
 */
 int str_remove_range(string_t *str, unsigned start, unsigned end);
 
@@ -96,9 +114,11 @@ char* str_to_cstr(string_t *str);
 
 /**
  * Returns a pointer to the internal buffer of the string_t.
- * A null terminator will be appended.
+ * The buffer is always NULL terminated, so this never modifies
+ * the string and it's safe to call from concurrent readers.
+ * @note The pointer is invalidated by any operation that modifies the string_t
  */
-const char* str_get_buffer(string_t *str);
+const char* str_get_buffer(const string_t *str);
 
 /**
  * Returns a substring of the string_t in the range [start, end)
@@ -115,6 +135,280 @@ string_t* str_dup(string_t *str);
  */
 size_t str_length(string_t *str);
 
+/**
+ * Returns a view of the contents of the string_t.
+ * @note The view is invalidated by any operation that modifies the string_t
+ */
+str_view_t str_as_view(const string_t *str);
+
+/**
+ * Compares two strings lexicographically, like memcmp, with the
+ * shorter string ordering first on a common prefix.
+ * A NULL argument is treated as an empty string.
+ * @return <0, 0 or >0 if str is less, equal or greater than other
+ */
+int str_cmp(const string_t *str, const string_t *other);
+int str_cmp_cstr(const string_t *str, const char *cstr);
+int str_cmp_view(const string_t *str, str_view_t view);
+
+/**
+ * Same as str_cmp, but ignoring the case of ASCII letters.
+ */
+int str_casecmp(const string_t *str, const string_t *other);
+int str_casecmp_cstr(const string_t *str, const char *cstr);
+int str_casecmp_view(const string_t *str, str_view_t view);
+
+/**
+ * Checks if two strings are equal.
+ * The lengths are checked first, so this is cheaper than str_cmp.
+ * @return 1 if equal, 0 if not
+ */
+int str_eq(const string_t *str, const string_t *other);
+int str_eq_cstr(const string_t *str, const char *cstr);
+int str_eq_view(const string_t *str, str_view_t view);
+
+/**
+ * Same as str_eq, but ignoring the case of ASCII letters.
+ */
+int str_caseeq(const string_t *str, const string_t *other);
+int str_caseeq_cstr(const string_t *str, const char *cstr);
+int str_caseeq_view(const string_t *str, str_view_t view);
+
+/**
+ * Checks if the string_t starts with the given prefix
+ * @return 1 if it does, 0 if not
+ */
+int str_starts_with(const string_t *str, const char *prefix);
+int str_starts_with_view(const string_t *str, str_view_t prefix);
+
+/**
+ * Checks if the string_t ends with the given suffix
+ * @return 1 if it does, 0 if not
+ */
+int str_ends_with(const string_t *str, const char *suffix);
+int str_ends_with_view(const string_t *str, str_view_t suffix);
+
+/**
+ * Same as str_starts_with and str_ends_with, but ignoring
+ * the case of ASCII letters.
+ */
+int str_case_starts_with(const string_t *str, const char *prefix);
+int str_case_starts_with_view(const string_t *str, str_view_t prefix);
+int str_case_ends_with(const string_t *str, const char *suffix);
+int str_case_ends_with_view(const string_t *str, str_view_t suffix);
+
+/**
+ * Parses a decimal integer from the range [start, end) of the string_t.
+ * An optional sign is accepted, and parsing stops at the first character
+ * that isn't a digit. No NULL terminator is needed and nothing is allocated.
+ * @param out where to store the parsed number
+ * @return the number of chars consumed, or
+ *         -1 if str or out are NULL,
+ *         -2 if the range is not valid,
+ *         -3 if there's no number at start,
+ *         -4 if the number doesn't fit in the type
+ */
+int str_parse_i64(const string_t *str, unsigned start, unsigned end, int64_t *out);
+int str_parse_u64(const string_t *str, unsigned start, unsigned end, uint64_t *out);
+
+/**
+ * Parses a floating point number from the range [start, end) of the string_t.
+ * Accepts the same decimal syntax as strtod, including "inf", "infinity"
+ * and "nan", but always with '.' as the decimal point.
+ * @param out where to store the parsed number
+ * @return the number of chars consumed, or a negative number on error
+ *         (see str_parse_i64)
+ */
+int str_parse_f64(const string_t *str, unsigned start, unsigned end, double *out);
+
+/**
+ * Returns the number of UTF-8 code points in the string_t.
+ * The functions below share a sparse index of the string, with the
+ * offset of every 64th code point, which is built on first use and
+ * extended as needed. Modifying the string only drops the part of the
+ * index after the modified position, so appending keeps it.
+ * Every byte that isn't a continuation byte (10xxxxxx) counts as a code
+ * point, invalid sequences are not detected.
+ * @note Building the index modifies the string_t internally, so the
+ *       first call on a string must not race with other readers.
+ */
+size_t str_utf8_length(const string_t *str);
+
+/**
+ * Returns the byte offset of the code point at the given index.
+ * @return the offset, or
+ *         -1 if str is NULL,
+ *         -2 if index is greater than the number of code points
+ * @note index can be equal to the number of code points, in which case
+ *       the length of the string is returned.
+ */
+long str_utf8_offset(const string_t *str, size_t index);
+
+/**
+ * Decodes the code point at the given index.
+ * @return the code point, or
+ *         -1 if str is NULL,
+ *         -2 if the index is out of bounds,
+ *         -3 if the code point is not valid UTF-8
+ */
+int32_t str_utf8_at(const string_t *str, size_t index);
+
+/**
+ * Returns the code points in the range [start, end) as a cstring.
+ * @note The cstring is allocated using malloc
+ */
+char* str_utf8_substring(const string_t *str, size_t start, size_t end);
+
+/**
+ * Replaces the UTF-8 contents of str with their full Unicode case
+ * folding, for case-insensitive matching. Unlike str_transform with
+ * tolower, it doesn't depend on the locale, and a character can fold
+ * into several ("\u00DF" folds into "ss").
+ * @return 1 on success, -1 if str is NULL,
+ *         -2 if str is not valid UTF-8, in which case it's left unchanged
+ */
+int str_casefold(string_t *str);
+
+/**
+ * Puts the UTF-8 contents of str in Unicode Normalization Form C
+ * (composed) or D (decomposed).
+ * @return 1 on success, -1 if str is NULL,
+ *         -2 if str is not valid UTF-8, in which case it's left unchanged
+ */
+int str_normalize_nfc(string_t *str);
+int str_normalize_nfd(string_t *str);
+
+/**
+ * Appends src to dst, escaped to be used inside a JSON string.
+ * '"', '\\' and the control characters are escaped, everything else,
+ * including UTF-8 sequences, is copied as is.
+ * @param n max length of src
+ */
+int str_escape_json(string_t *dst, const char *src, unsigned n);
+
+/**
+ * Appends src to dst, with '&', '<', '>', '"' and '\'' replaced by their
+ * HTML entities.
+ * @param n max length of src
+ */
+int str_escape_html(string_t *dst, const char *src, unsigned n);
+
+/**
+ * Appends src to dst, percent-encoding every byte that isn't an
+ * unreserved character of RFC 3986 (letters, digits, '-', '_', '.', '~').
+ * @param n max length of src
+ */
+int str_url_encode(string_t *dst, const char *src, unsigned n);
+
+/**
+ * Appends the contents of a JSON string (without the quotes) to dst,
+ * replacing the escape sequences. \uXXXX sequences are written as UTF-8.
+ * @param n max length of src
+ * @param error_at if not NULL, where to store the offset in src of the
+ *        first invalid escape sequence
+ * @return 1 on success, -1 if dst or src are NULL, or -2 if src has an
+ *         invalid escape sequence, in which case dst is left unchanged
+ */
+int str_unescape_json(string_t *dst, const char *src, unsigned n, size_t *error_at);
+
+/**
+ * Appends src to dst, replacing the HTML entities &amp; &lt; &gt; &quot;
+ * &apos; and the numeric ones (&#NNN; and &#xHHH;) with their characters.
+ * Any other entity is left as it is.
+ * @param n max length of src
+ */
+int str_unescape_html(string_t *dst, const char *src, unsigned n);
+
+/**
+ * Appends src to dst, decoding the %XX sequences.
+ * '+' is not decoded as a space.
+ * @param n max length of src
+ * @param error_at see str_unescape_json
+ * @return see str_unescape_json
+ */
+int str_url_decode(string_t *dst, const char *src, unsigned n, size_t *error_at);
+
+/**
+ * Appends the base64 encoding (RFC 4648, with padding) of the
+ * n bytes at src to dst.
+ */
+int str_append_base64(string_t *dst, const void *src, size_t n);
+
+/**
+ * Decodes the base64 text in src and appends the bytes to dst.
+ * The padding is optional, but if present it must be correct.
+ * @param n max length of src
+ * @param error_at if not NULL, where to store the offset in src of the
+ *        first invalid character
+ * @return 1 on success, -1 if dst or src are NULL, or -2 if src is not
+ *         valid base64, in which case dst is left unchanged
+ */
+int str_decode_base64(string_t *dst, const char *src, unsigned n, size_t *error_at);
+
+/**
+ * Appends the n bytes at src to dst, as lowercase hex digits.
+ */
+int str_append_hex(string_t *dst, const void *src, size_t n);
+
+/**
+ * Decodes the hex digits in src, in upper or lower case, and appends
+ * the bytes to dst.
+ * @param n max length of src
+ * @param error_at see str_decode_base64
+ * @return see str_decode_base64
+ */
+int str_decode_hex(string_t *dst, const char *src, unsigned n, size_t *error_at);
+
+/**
+ * Loads the contents of n files into string_ts.
+ * The reads of all the files are done at the same time, using io_uring
+ * when available, or a pool of threads if not. Each string_t is created
+ * with the size of its file, so its buffer is never reallocated.
+ * @param paths the paths of the files. NULL elements are skipped.
+ * @param out array of n elements where the string_ts are stored.
+ *        If a file can't be read, its element is set to NULL.
+ * @return the number of files loaded
+ */
+size_t str_load_files(const char **paths, size_t n, string_t **out);
+
+/**
+ * Computes the Levenshtein distance between two strings, byte by byte.
+ * Runs in O(n * m / 64) time, without allocating for strings of up to
+ * 64 characters.
+ * @return the distance, or -1 if a or b are NULL
+ */
+long str_edit_distance(const string_t *a, const string_t *b);
+
+/**
+ * Same as str_edit_distance, but gives up as soon as the distance is
+ * known to be greater than k.
+ * @return the distance, -1 if a or b are NULL, or -2 if it's greater than k
+ */
+long str_edit_distance_max(const string_t *a, const string_t *b, size_t k);
+
+/**
+ * Computes the distance between query and each of the n candidates,
+ * as str_edit_distance_max does, into out[i].
+ * The query is preprocessed only once, and on CPUs with AVX2, queries of
+ * up to 64 characters are run against 4 candidates at a time.
+ * @param k the bound, or SIZE_MAX for no bound
+ * @return 1 on success, -1 if query, candidates or out are NULL
+ */
+int str_edit_distance_batch(const string_t *query, string_t *const *candidates, size_t n, size_t k, long *out);
+
+/**
+ * Sorts an array of string_t in ascending order (see str_cmp).
+ * NULL elements are treated as empty strings.
+ */
+void str_sort(string_t **arr, size_t n);
+
+/**
+ * Same as str_sort, but for big arrays the work is split
+ * between n_threads threads.
+ * @param n_threads number of threads to use. If 0, one per online CPU.
+ */
+void str_sort_parallel(string_t **arr, size_t n, unsigned n_threads);
+
 /**
  * Splits the string_t into substrings, using the characters
  * in tokens as dividers.
@@ -146,6 +440,52 @@ char** str_split(string_t *str, char *delim);
  */
 int str_find_substring(string_t *str, const char *substr, unsigned start_at);
 
+/**
+ * Finds the first character, starting at index [start_at],
+ * that is any of the characters in chars
+ * @return Index of the character, -1 if there isn't any,
+ *         -2 if str or chars are NULL, -3 if start_at is out of bounds
+ */
+int str_find_any_of(const string_t *str, const char *chars, unsigned start_at);
+
+/**
+ * Finds the first character, starting at index [start_at],
+ * that is none of the characters in chars
+ * @return Same as str_find_any_of
+ */
+int str_find_not_of(const string_t *str, const char *chars, unsigned start_at);
+
+/**
+ * @return the number of characters, starting at index [start_at],
+ *         that are in accept
+ */
+size_t str_span(const string_t *str, const char *accept, unsigned start_at);
+
+/**
+ * @return the number of characters, starting at index [start_at],
+ *         that aren't in reject
+ */
+size_t str_cspan(const string_t *str, const char *reject, unsigned start_at);
+
+/**
+ * Removes the leading and trailing characters that are in chars,
+ * or whitespace if chars is NULL
+ * @note The buffer isn't shrinked
+ */
+int str_trim(string_t *str, const char *chars);
+
+/**
+ * Removes the leading characters that are in chars,
+ * or whitespace if chars is NULL
+ */
+int str_ltrim(string_t *str, const char *chars);
+
+/**
+ * Removes the trailing characters that are in chars,
+ * or whitespace if chars is NULL
+ */
+int str_rtrim(string_t *str, const char *chars);
+
 /**
  * Replaces any occurence of substr with replacement
  * @param substr string to replace
@@ -184,4 +524,17 @@ void str_free(string_t *str, ...);
 */
 void str_free_all(unsigned int n, ...);
 
+#ifdef __cplusplus
+}
+#endif
+
+/*
+ * Defining STR_INLINE before including this header replaces
+ * str_push_char, str_get_at, str_set_at, str_get_buffer and str_length
+ * with inline versions (see str_inline.h).
+ */
+#ifdef STR_INLINE
+#include "str_inline.h"
+#endif
+
 #endif // STR_H
@@ -0,0 +1,420 @@
+/*
+ * str.hpp - C++ wrappers of string_t and wstring_t.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * str::string and str::wstring own a string_t / wstring_t, and free it
+ * when they are destroyed. They are just the pointer, and every member
+ * is an inline call to the C function, so there is no overhead over
+ * using the C API directly.
+ * They convert to std::string_view / std::wstring_view without copying.
+ * As with the C API, the views and cstrings passed to them end at
+ * their first '\0'.
+ */
+#pragma once
+#ifndef STR_HPP
+#define STR_HPP
+
+#if __cplusplus < 201703L
+#error "str.hpp requires C++17"
+#endif
+
+#include "str.h"
+#include "wstr.h"
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace str {
+
+namespace detail {
+
+/* The C API takes lengths as unsigned */
+constexpr unsigned len(std::size_t n) noexcept {
+        return n > UINT_MAX ? UINT_MAX : static_cast<unsigned>(n);
+}
+
+template<class T, class View>
+using if_view = std::enable_if_t<std::is_convertible_v<const T&, View>, bool>;
+
+/* For the reversed comparisons, which must not match two wrappers */
+template<class T, class View, class Self>
+using if_other_view = std::enable_if_t<std::is_convertible_v<const T&, View>
+                                       && !std::is_same_v<T, Self>, bool>;
+
+}
+
+/**
+ * Owning wrapper of a string_t.
+ * A moved-from string behaves like an empty one.
+ */
+class string {
+public:
+        using value_type = char;
+        using size_type = std::size_t;
+        using const_iterator = const char*;
+        using iterator = const_iterator;
+        static constexpr size_type npos = std::string_view::npos;
+
+        string() : s(str_empty()) {}
+
+        /**
+         * Builds the string from a literal, whose length
+         * is known at compile time.
+         */
+        template<std::size_t N>
+        string(const char (&lit)[N]) : s(str_from_cstr(lit, N - 1)) {}
+
+        explicit string(std::string_view v)
+                : s(v.data() ? str_from_cstr(v.data(), detail::len(v.size())) : str_empty()) {}
+
+        /**
+         * Takes ownership of the given string_t.
+         */
+        explicit string(string_t *owned) noexcept : s(owned) {}
+
+        string(const string &other) : s(str_dup(other.s)) {}
+        string(string &&other) noexcept : s(std::exchange(other.s, nullptr)) {}
+
+        string& operator=(const string &other) {
+                if (this != &other)
+                        string(other).swap(*this);
+                return *this;
+        }
+
+        string& operator=(string &&other) noexcept {
+                if (this != &other) {
+                        str_free(s);
+                        s = std::exchange(other.s, nullptr);
+                }
+                return *this;
+        }
+
+        ~string() { str_free(s); }
+
+        void swap(string &other) noexcept { std::swap(s, other.s); }
+
+        /** @return the wrapped string_t, still owned by this object */
+        string_t* get() const noexcept { return s; }
+
+        /** Gives up ownership of the string_t, which must be freed by the caller */
+        string_t* release() noexcept { return std::exchange(s, nullptr); }
+
+        size_type size() const noexcept { return str_length(s); }
+        size_type length() const noexcept { return str_length(s); }
+        bool empty() const noexcept { return size() == 0; }
+
+        std::string_view view() const noexcept {
+                str_view_t v = str_as_view(s);
+                return std::string_view(v.buf, v.len);
+        }
+        operator std::string_view() const noexcept { return view(); }
+        const char* c_str() const noexcept { return view().data(); }
+        const char* data() const noexcept { return view().data(); }
+
+        /* Iteration is read only, characters are changed through set */
+        const_iterator begin() const noexcept { return data(); }
+        const_iterator end() const noexcept { return data() + size(); }
+
+        char operator[](size_type i) const noexcept { return data()[i]; }
+        char at(size_type i) const noexcept { return str_get_at(s, detail::len(i)); }
+        void set(size_type i, char c) noexcept { str_set_at(handle(), detail::len(i), c); }
+
+        string& append(std::string_view v) noexcept {
+                str_concat_cstr(handle(), v.data(), detail::len(v.size()));
+                return *this;
+        }
+        template<std::size_t N>
+        string& append(const char (&lit)[N]) noexcept {
+                str_concat_cstr(handle(), lit, N - 1);
+                return *this;
+        }
+        string& append(const string &other) noexcept {
+                str_concat_str(handle(), other.s);
+                return *this;
+        }
+        void push_back(char c) noexcept { str_push_char(handle(), c); }
+        void pop_back() noexcept { str_pop(handle()); }
+
+        string& operator+=(std::string_view v) noexcept { return append(v); }
+        template<std::size_t N>
+        string& operator+=(const char (&lit)[N]) noexcept { return append(lit); }
+        string& operator+=(const string &other) noexcept { return append(other); }
+        string& operator+=(char c) noexcept {
+                push_back(c);
+                return *this;
+        }
+
+        void insert(size_type index, std::string_view v) noexcept {
+                str_insert_cstr(handle(), v.data(), detail::len(v.size()), detail::len(index));
+        }
+        void remove_at(size_type index) noexcept { str_remove_at(handle(), detail::len(index)); }
+        void remove_range(size_type start, size_type end) noexcept {
+                str_remove_range(handle(), detail::len(start), detail::len(end));
+        }
+
+        size_type find(std::string_view v, size_type pos = 0) const noexcept { return view().find(v, pos); }
+        bool starts_with(std::string_view v) const noexcept {
+                return str_starts_with_view(s, str_view_t{v.data(), v.size()});
+        }
+        bool ends_with(std::string_view v) const noexcept {
+                return str_ends_with_view(s, str_view_t{v.data(), v.size()});
+        }
+
+        /** @param chars characters to trim, whitespace if NULL */
+        void trim(const char *chars = nullptr) noexcept { str_trim(handle(), chars); }
+        void ltrim(const char *chars = nullptr) noexcept { str_ltrim(handle(), chars); }
+        void rtrim(const char *chars = nullptr) noexcept { str_rtrim(handle(), chars); }
+
+        void reserve(size_type n) noexcept { str_reserve(handle(), detail::len(n)); }
+        void shrink_to_fit() noexcept { str_shrink(handle()); }
+        void clear() noexcept { str_clear(handle()); }
+
+        int compare(std::string_view v) const noexcept {
+                return str_cmp_view(s, str_view_t{v.data(), v.size()});
+        }
+        bool equals(std::string_view v) const noexcept {
+                return str_eq_view(s, str_view_t{v.data(), v.size()});
+        }
+
+        template<class T, detail::if_view<T, std::string_view> = true>
+        friend bool operator==(const string &a, const T &b) noexcept { return a.equals(b); }
+        template<class T, detail::if_view<T, std::string_view> = true>
+        friend bool operator!=(const string &a, const T &b) noexcept { return !a.equals(b); }
+        template<class T, detail::if_view<T, std::string_view> = true>
+        friend bool operator<(const string &a, const T &b) noexcept { return a.compare(b) < 0; }
+        template<class T, detail::if_view<T, std::string_view> = true>
+        friend bool operator>(const string &a, const T &b) noexcept { return a.compare(b) > 0; }
+        template<class T, detail::if_view<T, std::string_view> = true>
+        friend bool operator<=(const string &a, const T &b) noexcept { return a.compare(b) <= 0; }
+        template<class T, detail::if_view<T, std::string_view> = true>
+        friend bool operator>=(const string &a, const T &b) noexcept { return a.compare(b) >= 0; }
+        template<class T, detail::if_other_view<T, std::string_view, string> = true>
+        friend bool operator==(const T &a, const string &b) noexcept { return b.equals(a); }
+        template<class T, detail::if_other_view<T, std::string_view, string> = true>
+        friend bool operator!=(const T &a, const string &b) noexcept { return !b.equals(a); }
+
+private:
+        string_t *s;
+
+        /* A moved-from object gets a new empty handle when it's modified */
+        string_t* handle() noexcept {
+                if (!s)
+                        s = str_empty();
+                return s;
+        }
+};
+
+/**
+ * Owning wrapper of a wstring_t.
+ * A moved-from wstring behaves like an empty one.
+ * @note Viewing a compact wstring_t builds its wchar_t copy (see wstr_get_buffer),
+ *       comparing it doesn't.
+ */
+class wstring {
+public:
+        using value_type = wchar_t;
+        using size_type = std::size_t;
+        using const_iterator = const wchar_t*;
+        using iterator = const_iterator;
+        static constexpr size_type npos = std::wstring_view::npos;
+
+        wstring() : s(wstr_empty()) {}
+
+        template<std::size_t N>
+        wstring(const wchar_t (&lit)[N]) : s(wstr_from_cwstr(lit, N - 1)) {}
+
+        explicit wstring(std::wstring_view v)
+                : s(v.data() ? wstr_from_cwstr(v.data(), detail::len(v.size())) : wstr_empty()) {}
+
+        /**
+         * Builds the wstring from a multibyte string (see wstr_from_cstr).
+         */
+        explicit wstring(std::string_view v)
+                : s(v.data() ? wstr_from_cstr(v.data(), detail::len(v.size())) : wstr_empty()) {}
+
+        /**
+         * Takes ownership of the given wstring_t.
+         */
+        explicit wstring(wstring_t *owned) noexcept : s(owned) {}
+
+        wstring(const wstring &other) : s(wstr_dup(other.s)) {}
+        wstring(wstring &&other) noexcept : s(std::exchange(other.s, nullptr)) {}
+
+        wstring& operator=(const wstring &other) {
+                if (this != &other)
+                        wstring(other).swap(*this);
+                return *this;
+        }
+
+        wstring& operator=(wstring &&other) noexcept {
+                if (this != &other) {
+                        wstr_free(s);
+                        s = std::exchange(other.s, nullptr);
+                }
+                return *this;
+        }
+
+        ~wstring() { wstr_free(s); }
+
+        void swap(wstring &other) noexcept { std::swap(s, other.s); }
+
+        /** @return the wrapped wstring_t, still owned by this object */
+        wstring_t* get() const noexcept { return s; }
+
+        /** Gives up ownership of the wstring_t, which must be freed by the caller */
+        wstring_t* release() noexcept { return std::exchange(s, nullptr); }
+
+        size_type size() const noexcept { return wstr_length(s); }
+        size_type length() const noexcept { return wstr_length(s); }
+        bool empty() const noexcept { return size() == 0; }
+
+        std::wstring_view view() const noexcept {
+                wstr_view_t v = wstr_as_view(s);
+                return std::wstring_view(v.buf, v.len);
+        }
+        operator std::wstring_view() const noexcept { return view(); }
+        const wchar_t* c_str() const noexcept { return view().data(); }
+        const wchar_t* data() const noexcept { return view().data(); }
+
+        const_iterator begin() const noexcept { return data(); }
+        const_iterator end() const noexcept { return data() + size(); }
+
+        wchar_t operator[](size_type i) const noexcept { return wstr_get_at(s, detail::len(i)); }
+        wchar_t at(size_type i) const noexcept { return wstr_get_at(s, detail::len(i)); }
+        void set(size_type i, wchar_t c) noexcept { wstr_set_at(handle(), detail::len(i), c); }
+
+        wstring& append(std::wstring_view v) noexcept {
+                wstr_concat_cwstr(handle(), v.data(), detail::len(v.size()));
+                return *this;
+        }
+        template<std::size_t N>
+        wstring& append(const wchar_t (&lit)[N]) noexcept {
+                wstr_concat_cwstr(handle(), lit, N - 1);
+                return *this;
+        }
+        wstring& append(const wstring &other) noexcept {
+                wstr_concat_wstr(handle(), other.s);
+                return *this;
+        }
+        void push_back(wchar_t c) noexcept { wstr_push_char(handle(), c); }
+        void pop_back() noexcept { wstr_pop(handle()); }
+
+        wstring& operator+=(std::wstring_view v) noexcept { return append(v); }
+        template<std::size_t N>
+        wstring& operator+=(const wchar_t (&lit)[N]) noexcept { return append(lit); }
+        wstring& operator+=(const wstring &other) noexcept { return append(other); }
+        wstring& operator+=(wchar_t c) noexcept {
+                push_back(c);
+                return *this;
+        }
+
+        void insert(size_type index, std::wstring_view v) noexcept {
+                wstr_insert_cwstr(handle(), v.data(), detail::len(v.size()), detail::len(index));
+        }
+        void remove_at(size_type index) noexcept { wstr_remove_at(handle(), detail::len(index)); }
+        void remove_range(size_type start, size_type end) noexcept {
+                wstr_remove_range(handle(), detail::len(start), detail::len(end));
+        }
+
+        size_type find(std::wstring_view v, size_type pos = 0) const noexcept { return view().find(v, pos); }
+        bool starts_with(std::wstring_view v) const noexcept {
+                return wstr_starts_with_view(s, wstr_view_t{v.data(), v.size()});
+        }
+        bool ends_with(std::wstring_view v) const noexcept {
+                return wstr_ends_with_view(s, wstr_view_t{v.data(), v.size()});
+        }
+
+        /** @param chars characters to trim, whitespace if NULL */
+        void trim(const wchar_t *chars = nullptr) noexcept { wstr_trim(handle(), chars); }
+        void ltrim(const wchar_t *chars = nullptr) noexcept { wstr_ltrim(handle(), chars); }
+        void rtrim(const wchar_t *chars = nullptr) noexcept { wstr_rtrim(handle(), chars); }
+
+        void reserve(size_type n) noexcept { wstr_reserve(handle(), detail::len(n)); }
+        void shrink_to_fit() noexcept { wstr_shrink(handle()); }
+        void clear() noexcept { wstr_clear(handle()); }
+
+        /** Switches to compact storage (see wstr_compact) */
+        void compact() noexcept { wstr_compact(handle()); }
+
+        int compare(std::wstring_view v) const noexcept {
+                return wstr_cmp_view(s, wstr_view_t{v.data(), v.size()});
+        }
+        bool equals(std::wstring_view v) const noexcept {
+                return wstr_eq_view(s, wstr_view_t{v.data(), v.size()});
+        }
+        /* Comparing two wstrings doesn't go through their views */
+        template<class T, std::enable_if_t<std::is_same_v<T, wstring>, bool> = true>
+        int compare(const T &other) const noexcept { return wstr_cmp(s, other.s); }
+        template<class T, std::enable_if_t<std::is_same_v<T, wstring>, bool> = true>
+        bool equals(const T &other) const noexcept { return wstr_eq(s, other.s); }
+
+        template<class T, detail::if_view<T, std::wstring_view> = true>
+        friend bool operator==(const wstring &a, const T &b) noexcept { return a.equals(b); }
+        template<class T, detail::if_view<T, std::wstring_view> = true>
+        friend bool operator!=(const wstring &a, const T &b) noexcept { return !a.equals(b); }
+        template<class T, detail::if_view<T, std::wstring_view> = true>
+        friend bool operator<(const wstring &a, const T &b) noexcept { return a.compare(b) < 0; }
+        template<class T, detail::if_view<T, std::wstring_view> = true>
+        friend bool operator>(const wstring &a, const T &b) noexcept { return a.compare(b) > 0; }
+        template<class T, detail::if_view<T, std::wstring_view> = true>
+        friend bool operator<=(const wstring &a, const T &b) noexcept { return a.compare(b) <= 0; }
+        template<class T, detail::if_view<T, std::wstring_view> = true>
+        friend bool operator>=(const wstring &a, const T &b) noexcept { return a.compare(b) >= 0; }
+        template<class T, detail::if_other_view<T, std::wstring_view, wstring> = true>
+        friend bool operator==(const T &a, const wstring &b) noexcept { return b.equals(a); }
+        template<class T, detail::if_other_view<T, std::wstring_view, wstring> = true>
+        friend bool operator!=(const T &a, const wstring &b) noexcept { return !b.equals(a); }
+
+private:
+        wstring_t *s;
+
+        /* A moved-from object gets a new empty handle when it's modified */
+        wstring_t* handle() noexcept {
+                if (!s)
+                        s = wstr_empty();
+                return s;
+        }
+};
+
+inline void swap(string &a, string &b) noexcept { a.swap(b); }
+inline void swap(wstring &a, wstring &b) noexcept { a.swap(b); }
+
+namespace literals {
+
+/**
+ * "text"_s builds a str::string, with the length given by the compiler.
+ */
+inline string operator""_s(const char *lit, std::size_t n) {
+        return string(str_from_cstr(lit, detail::len(n)));
+}
+
+inline wstring operator""_s(const wchar_t *lit, std::size_t n) {
+        return wstring(wstr_from_cwstr(lit, detail::len(n)));
+}
+
+}
+
+}
+
+namespace std {
+
+template<>
+struct hash<str::string> {
+        size_t operator()(const str::string &s) const noexcept {
+                return hash<string_view>()(s.view());
+        }
+};
+
+template<>
+struct hash<str::wstring> {
+        size_t operator()(const str::wstring &s) const noexcept {
+                return hash<wstring_view>()(s.view());
+        }
+};
+
+}
+
+#endif // STR_HPP
@@ -0,0 +1,122 @@
+/*
+ * str_appender.c - str_appender_t implementation.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * The appender has two segments, each one wrapping a string_t with a
+ * fixed capacity. Producers reserve a range of the active segment with
+ * a fetch-add on its reserved counter, copy their text, and then add
+ * its length to the committed counter. Draining switches the active
+ * segment, closes the old one by setting the CLOSED bit of its counter,
+ * and waits until every reservation made before that is committed.
+ * Segments are never freed while the appender lives, so a producer
+ * holding a stale segment can only see it closed (and retry) or
+ * reopened (and use it).
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str_appender.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memcpy, strnlen
+#include <stdatomic.h>
+#include <sched.h>  // sched_yield
+#include "internal.h"
+
+#define CLOSED ((uint64_t)1 << 63)
+#define NO_HOLE SIZE_MAX
+#define CACHE_LINE 64
+
+struct segment {
+	_Alignas(CACHE_LINE) _Atomic uint64_t reserved;
+	_Alignas(CACHE_LINE) atomic_size_t committed;
+	/* Start of the range reserved by the append that didn't fit */
+	atomic_size_t hole;
+	string_t *str;
+};
+
+struct str_appender {
+	struct segment segs[2];
+	atomic_uint active;
+	size_t capacity;
+};
+
+static void __open_segment(struct segment *seg, string_t *str){
+	seg->str = str;
+	atomic_store_explicit(&seg->committed, 0, memory_order_relaxed);
+	atomic_store_explicit(&seg->hole, NO_HOLE, memory_order_relaxed);
+	atomic_store_explicit(&seg->reserved, 0, memory_order_release);
+}
+
+str_appender_t* str_appender_init(unsigned capacity){
+	str_appender_t *app = aligned_alloc(CACHE_LINE, sizeof(*app));
+	assert(app);
+	app->capacity = capacity;
+	app->segs[1].str = NULL;
+	atomic_init(&app->segs[1].reserved, CLOSED);
+	atomic_init(&app->segs[1].committed, 0);
+	atomic_init(&app->segs[1].hole, NO_HOLE);
+	__open_segment(&app->segs[0], str_init(capacity));
+	atomic_init(&app->active, 0);
+	return app;
+}
+
+int str_appender_append(str_appender_t *app, const char *src, unsigned n){
+	if (!app || !src)
+		return -1;
+	size_t len = strnlen(src, n);
+	if (len == 0)
+		return 1;
+	for (;;){
+		unsigned active = atomic_load_explicit(&app->active, memory_order_acquire);
+		struct segment *seg = &app->segs[active];
+		uint64_t off = atomic_fetch_add_explicit(&seg->reserved, len, memory_order_acq_rel);
+		if (off & CLOSED)
+			continue; // Being drained, the active segment has already changed
+		if (off + len > app->capacity){
+			/* Only the append that crosses the capacity leaves a hole.
+			 * Its committed bytes are padding that the drain cuts off. */
+			if (off < app->capacity){
+				atomic_store_explicit(&seg->hole, off, memory_order_relaxed);
+				atomic_fetch_add_explicit(&seg->committed, app->capacity - off, memory_order_release);
+			}
+			return -2;
+		}
+		memcpy(&seg->str->buffer[off], src, len * sizeof(char));
+		atomic_fetch_add_explicit(&seg->committed, len, memory_order_release);
+		return 1;
+	}
+}
+
+string_t* str_appender_drain(str_appender_t *app, string_t *replacement){
+	if (!app)
+		return NULL;
+	if (!replacement)
+		replacement = str_init(app->capacity);
+	str_clear(replacement);
+	str_reserve(replacement, app->capacity);
+
+	unsigned active = atomic_load_explicit(&app->active, memory_order_relaxed);
+	struct segment *old = &app->segs[active];
+	__open_segment(&app->segs[active ^ 1], replacement);
+	atomic_store_explicit(&app->active, active ^ 1, memory_order_release);
+
+	uint64_t reserved = atomic_fetch_or_explicit(&old->reserved, CLOSED, memory_order_acq_rel);
+	size_t target = reserved < app->capacity ? reserved : app->capacity;
+	while (atomic_load_explicit(&old->committed, memory_order_acquire) != target)
+		sched_yield();
+
+	size_t hole = atomic_load_explicit(&old->hole, memory_order_relaxed);
+	string_t *str = old->str;
+	old->str = NULL;
+	str->length = hole != NO_HOLE ? hole : target;
+	str->buffer[str->length] = '\0';
+	return str;
+}
+
+void str_appender_free(str_appender_t *app){
+	if (!app)
+		return;
+	str_free(app->segs[0].str);
+	str_free(app->segs[1].str);
+	free(app);
+}
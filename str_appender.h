@@ -0,0 +1,60 @@
+/*
+ * str_appender.h - str_appender_t definition.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * A str_appender_t accumulates text appended concurrently by any number
+ * of threads, without locks. Space is reserved with an atomic fetch-add
+ * and the text is copied outside of any critical section. A single
+ * consumer thread can take the accumulated text at any moment with
+ * str_appender_drain, while the producers keep appending.
+ */
+#pragma once
+#ifndef STR_APPENDER_H
+#define STR_APPENDER_H
+
+#include "str.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct str_appender str_appender_t;
+
+/**
+ * Builds a str_appender_t
+ * @param capacity max number of chars that can be accumulated
+ *                 between two calls to str_appender_drain
+ */
+str_appender_t* str_appender_init(unsigned capacity);
+
+/**
+ * Appends the given cstring. Safe to call from multiple threads at once.
+ * @param n max length of src
+ * @return 1 on success, -1 if app or src are NULL,
+ *         -2 if there's no space left until the next drain.
+ */
+int str_appender_append(str_appender_t *app, const char *src, unsigned n);
+
+/**
+ * Takes all the text appended until now, in reservation order.
+ * Producers are never blocked: appends that race with the drain end up
+ * either in the returned string or in the next one.
+ * @note Only one thread at a time can call this function.
+ * @param replacement string_t that will accumulate the next appends.
+ *        It's cleared and grown to the capacity of app if needed.
+ *        If NULL, a new one is allocated.
+ * @return the accumulated string_t. The caller owns it.
+ */
+string_t* str_appender_drain(str_appender_t *app, string_t *replacement);
+
+/**
+ * Frees the str_appender_t and the text it holds.
+ * @note No other thread can be using it.
+ */
+void str_appender_free(str_appender_t *app);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STR_APPENDER_H
@@ -0,0 +1,335 @@
+/*
+ * str_csv.c - str_csv_reader_t implementation.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * The input is classified in blocks of 64 bytes, getting a bitmask of
+ * the quotes, delimiters and newlines of each block. The prefix xor of
+ * the quote mask marks the bytes inside quoted sections (a doubled
+ * quote just toggles it twice), so the delimiters and newlines that
+ * end fields are the ones outside of it. The masks of the current
+ * block are kept between records, so short records don't classify
+ * the same block again.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str_csv.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memchr, memcpy, memmove
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "util.h"
+#include "internal.h"
+
+#define CSV_BUFFER_SIZE (64 * 1024)
+#define INITIAL_FIELDS 16
+
+struct csv_field {
+	size_t start;
+	size_t end;
+};
+
+struct str_csv_reader {
+	int   fd;
+	FILE *file;
+	char  delim;
+	int   eof;
+	int   owned;  // buf belongs to the reader
+	char *buf;
+	size_t cap;
+	size_t end;   // bytes of input in buf
+	size_t pos;   // start of the current record
+	size_t next;  // start of the next record
+	/* Block classification state */
+	size_t   scan;   // start of the next block to classify
+	size_t   block;  // start of the last block
+	uint64_t ends;   // pending field ends of the last block
+	uint64_t nl;     // newlines of the last block
+	uint64_t inside; // all ones if the last block ended inside quotes
+	/* Fields of the current record */
+	size_t field_start; // start of the field being scanned
+	struct csv_field *fields;
+	size_t n_fields;
+	size_t fields_cap;
+};
+
+static str_csv_reader_t* __csv_init(int fd, FILE *file, char delim){
+	if (delim == '\0' || delim == '"' || delim == '\r' || delim == '\n')
+		return NULL;
+	str_csv_reader_t *csv = calloc(1, sizeof(*csv));
+	assert(csv);
+	csv->fd = fd;
+	csv->file = file;
+	csv->delim = delim;
+	csv->fields_cap = INITIAL_FIELDS;
+	csv->fields = malloc(INITIAL_FIELDS * sizeof(struct csv_field));
+	assert(csv->fields);
+	return csv;
+}
+
+str_csv_reader_t* str_csv_reader_from_str(const string_t *str, char delim){
+	if (!str)
+		return NULL;
+	str_csv_reader_t *csv = __csv_init(-1, NULL, delim);
+	if (csv){
+		/* Never written, refilling is only done when there's no eof */
+		csv->buf = str->buffer;
+		csv->end = csv->cap = str->length;
+		csv->eof = 1;
+	}
+	return csv;
+}
+
+static str_csv_reader_t* __csv_init_owned(int fd, FILE *file, char delim){
+	str_csv_reader_t *csv = __csv_init(fd, file, delim);
+	if (csv){
+		csv->owned = 1;
+		csv->cap = CSV_BUFFER_SIZE;
+		csv->buf = malloc(csv->cap);
+		assert(csv->buf);
+	}
+	return csv;
+}
+
+str_csv_reader_t* str_csv_reader_from_fd(int fd, char delim){
+	if (fd < 0)
+		return NULL;
+	return __csv_init_owned(fd, NULL, delim);
+}
+
+str_csv_reader_t* str_csv_reader_from_file(FILE *file, char delim){
+	if (!file)
+		return NULL;
+	return __csv_init_owned(-1, file, delim);
+}
+
+/*
+ * Moves the current record to the start of the buffer, growing it if
+ * the record fills it, and reads more input after it.
+ * The classification state and the fields already found move with
+ * the record, so only the new bytes are classified.
+ * @return the number of bytes read, 0 at EOF, -1 on error
+ */
+static long __refill(str_csv_reader_t *csv){
+	size_t shift = csv->pos;
+	if (shift > 0){
+		memmove(csv->buf, &csv->buf[shift], csv->end - shift);
+		csv->end -= shift;
+		csv->next -= shift;
+		csv->pos = 0;
+		/* ends is empty here, so block is not needed anymore */
+		csv->scan -= shift;
+		csv->field_start -= shift;
+		for (size_t i = 0; i < csv->n_fields; i++){
+			csv->fields[i].start -= shift;
+			csv->fields[i].end -= shift;
+		}
+	}
+	if (csv->end == csv->cap)
+		csv->buf = __grow_chars(csv->buf, &csv->cap, csv->cap + 1, 0);
+	long n = __read_some(csv->fd, csv->file, &csv->buf[csv->end], csv->cap - csv->end);
+	if (n < 0)
+		return -1;
+	if (n == 0)
+		csv->eof = 1;
+	csv->end += n;
+	return n;
+}
+
+static INLINE uint64_t __prefix_xor(uint64_t x){
+	x ^= x << 1;
+	x ^= x << 2;
+	x ^= x << 4;
+	x ^= x << 8;
+	x ^= x << 16;
+	x ^= x << 32;
+	return x;
+}
+
+static INLINE void __classify(const char *p, char delim, uint64_t *quote, uint64_t *sep, uint64_t *nl){
+	*quote = *sep = *nl = 0;
+#ifdef __SSE2__
+	const __m128i q = _mm_set1_epi8('"');
+	const __m128i d = _mm_set1_epi8(delim);
+	const __m128i n = _mm_set1_epi8('\n');
+	for (int k = 0; k < 4; k++){
+		__m128i x = _mm_loadu_si128((const __m128i*)&p[16 * k]);
+		*quote |= (uint64_t)(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, q)) << (16 * k);
+		*sep   |= (uint64_t)(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, d)) << (16 * k);
+		*nl    |= (uint64_t)(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(x, n)) << (16 * k);
+	}
+#else
+	for (int k = 0; k < 64; k++){
+		*quote |= (uint64_t)(p[k] == '"') << k;
+		*sep   |= (uint64_t)(p[k] == delim) << k;
+		*nl    |= (uint64_t)(p[k] == '\n') << k;
+	}
+#endif
+}
+
+/*
+ * Classifies the next block. If less than 64 bytes are left, the block
+ * is cut short at the end of the input, and the next one starts there
+ * once more input comes, so a record that is already complete is
+ * never held back waiting for more.
+ * @return 1 on success, 0 if there's no input left but more can come,
+ *         -1 if there's no input left
+ */
+static int __next_block(str_csv_reader_t *csv){
+	size_t i = csv->scan;
+	if (i >= csv->end)
+		return csv->eof ? -1 : 0;
+	size_t len = 64;
+	uint64_t quote, sep, nl;
+	if (i + 64 <= csv->end){
+		__classify(&csv->buf[i], csv->delim, &quote, &sep, &nl);
+	} else {
+		/* The delimiter can't be '\0', so the padding matches nothing */
+		len = csv->end - i;
+		char tmp[64] = {0};
+		memcpy(tmp, &csv->buf[i], len);
+		__classify(tmp, csv->delim, &quote, &sep, &nl);
+	}
+	uint64_t inside = __prefix_xor(quote) ^ csv->inside;
+	csv->inside = (uint64_t)((int64_t)inside >> 63);
+	csv->ends = (sep | nl) & ~inside;
+	csv->nl = nl;
+	csv->block = i;
+	csv->scan = i + len;
+	return 1;
+}
+
+static void __push_field(str_csv_reader_t *csv, size_t start, size_t end){
+	if (csv->n_fields == csv->fields_cap){
+		csv->fields_cap *= 2;
+		csv->fields = realloc(csv->fields, csv->fields_cap * sizeof(struct csv_field));
+		assert(csv->fields);
+	}
+	csv->fields[csv->n_fields++] = (struct csv_field){ .start = start, .end = end };
+}
+
+/*
+ * Splits the record that starts at pos, going on from the field at
+ * field_start if a previous call ran out of input.
+ * @return 1 if it was found, 0 if more input is needed,
+ *         -3 if the input ends inside quotes
+ */
+static int __scan_record(str_csv_reader_t *csv){
+	size_t start = csv->field_start;
+	for (;;){
+		while (csv->ends == 0){
+			int r = __next_block(csv);
+			if (r == 0){
+				csv->field_start = start;
+				return 0;
+			}
+			if (r < 0){
+				if (csv->inside)
+					return -3;
+				__push_field(csv, start, csv->end);
+				csv->next = csv->end;
+				return 1;
+			}
+		}
+		unsigned bit = __builtin_ctzll(csv->ends);
+		csv->ends &= csv->ends - 1;
+		size_t p = csv->block + bit;
+		if (csv->nl >> bit & 1){
+			size_t end = p;
+			if (end > start && csv->buf[end - 1] == '\r')
+				end--;
+			__push_field(csv, start, end);
+			csv->next = p + 1;
+			return 1;
+		}
+		__push_field(csv, start, p);
+		start = p + 1;
+	}
+}
+
+int str_csv_next_record(str_csv_reader_t *csv){
+	if (!csv)
+		return -1;
+	csv->pos = csv->field_start = csv->next;
+	csv->n_fields = 0;
+	for (;;){
+		if (csv->pos >= csv->end && csv->eof)
+			return 0;
+		int r = __scan_record(csv);
+		if (r == 1)
+			return csv->n_fields;
+		if (r < 0)
+			return r;
+		if (__refill(csv) < 0)
+			return -2;
+	}
+}
+
+static INLINE int __is_quoted(const str_csv_reader_t *csv, const struct csv_field *f){
+	return f->end > f->start && csv->buf[f->start] == '"';
+}
+
+str_view_t str_csv_field(const str_csv_reader_t *csv, size_t i){
+	if (!csv || i >= csv->n_fields)
+		return (str_view_t){ .buf = "", .len = 0 };
+	const struct csv_field *f = &csv->fields[i];
+	size_t start = f->start, end = f->end;
+	if (__is_quoted(csv, f)){
+		start++;
+		if (end > start && csv->buf[end - 1] == '"')
+			end--;
+	}
+	return (str_view_t){ .buf = &csv->buf[start], .len = end - start };
+}
+
+int str_csv_field_is_quoted(const str_csv_reader_t *csv, size_t i){
+	if (!csv || i >= csv->n_fields)
+		return 0;
+	return __is_quoted(csv, &csv->fields[i]);
+}
+
+int str_csv_unescape_field(const str_csv_reader_t *csv, size_t i, string_t *out){
+	if (!csv || !out)
+		return -1;
+	if (i >= csv->n_fields)
+		return -2;
+	str_view_t v = str_csv_field(csv, i);
+	__str_reserve(out, v.len);
+	if (!__is_quoted(csv, &csv->fields[i])){
+		memcpy(&out->buffer[out->length], v.buf, v.len * sizeof(char));
+		__str_modified(out, out->length);
+		out->length += v.len;
+		out->buffer[out->length] = '\0';
+		return 1;
+	}
+	char *dst = &out->buffer[out->length];
+	const char *src = v.buf, *end = v.buf + v.len;
+	while (src < end){
+		const char *quote = memchr(src, '"', end - src);
+		if (!quote)
+			quote = end;
+		memcpy(dst, src, (quote - src) * sizeof(char));
+		dst += quote - src;
+		if (quote == end)
+			break;
+		/* Keep one of a pair of quotes */
+		*dst++ = '"';
+		src = quote + 1;
+		if (src < end && *src == '"')
+			src++;
+	}
+	__str_modified(out, out->length);
+	out->length = dst - out->buffer;
+	out->buffer[out->length] = '\0';
+	return 1;
+}
+
+void str_csv_reader_free(str_csv_reader_t *csv){
+	if (csv){
+		if (csv->owned)
+			free(csv->buf);
+		free(csv->fields);
+		free(csv);
+	}
+}
@@ -0,0 +1,92 @@
+/*
+ * str_csv.h - str_csv_reader_t definition.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * A str_csv_reader_t splits delimited records (CSV, TSV...) from a
+ * string_t, a file descriptor or a FILE*, following RFC 4180: fields
+ * can be quoted with '"', and then hold delimiters, newlines and
+ * doubled quotes. Records end with "\n" or "\r\n".
+ * Fields are returned as views into the input, so parsing doesn't
+ * allocate per field. Unescaping a quoted field is done only when
+ * asked for, with str_csv_unescape_field.
+ */
+#pragma once
+#ifndef STR_CSV_H
+#define STR_CSV_H
+
+#include "str.h"
+#include <stdio.h> // FILE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct str_csv_reader str_csv_reader_t;
+
+/**
+ * Builds a str_csv_reader_t that parses the contents of str.
+ * @param delim the field delimiter. It can't be '\0', '"', '\r' or '\n'.
+ * @note str must not be modified or freed while the reader is in use
+ * @return the reader, or NULL if str is NULL or delim is not valid
+ */
+str_csv_reader_t* str_csv_reader_from_str(const string_t *str, char delim);
+
+/**
+ * Builds a str_csv_reader_t that reads from the given file descriptor.
+ * @param delim see str_csv_reader_from_str
+ * @note The file descriptor is not closed by str_csv_reader_free
+ */
+str_csv_reader_t* str_csv_reader_from_fd(int fd, char delim);
+
+/**
+ * Builds a str_csv_reader_t that reads from the given FILE.
+ * @param delim see str_csv_reader_from_str
+ * @note The FILE is not closed by str_csv_reader_free
+ */
+str_csv_reader_t* str_csv_reader_from_file(FILE *file, char delim);
+
+/**
+ * Parses the next record.
+ * The last record doesn't need to end with a newline.
+ * Quotes in the middle of an unquoted field are not rejected, they
+ * start a quoted section all the same.
+ * @return the number of fields of the record, 0 at the end of the input,
+ *         -1 if csv is NULL, -2 on a read error,
+ *         -3 if the input ends inside a quoted field
+ */
+int str_csv_next_record(str_csv_reader_t *csv);
+
+/**
+ * Returns field i of the current record.
+ * For quoted fields the surrounding quotes are left out, but doubled
+ * quotes inside are not unescaped.
+ * @return a view of the field, or an empty view if i is out of bounds.
+ * @note The view is invalidated by the next call to str_csv_next_record
+ */
+str_view_t str_csv_field(const str_csv_reader_t *csv, size_t i);
+
+/**
+ * Checks if field i of the current record is quoted, in which case
+ * it may need to be unescaped.
+ * @return 1 if it is, 0 if not or if i is out of bounds
+ */
+int str_csv_field_is_quoted(const str_csv_reader_t *csv, size_t i);
+
+/**
+ * Appends field i of the current record to out, with doubled
+ * quotes unescaped.
+ * @return 1 on success, -1 if csv or out are NULL,
+ *         -2 if i is out of bounds
+ */
+int str_csv_unescape_field(const str_csv_reader_t *csv, size_t i, string_t *out);
+
+/**
+ * Frees the str_csv_reader_t
+ */
+void str_csv_reader_free(str_csv_reader_t *csv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STR_CSV_H
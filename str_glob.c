@@ -0,0 +1,487 @@
+/*
+ * str_glob.c - str_glob_t implementation.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Each pattern is turned into a sequence of tokens (*, or a set of
+ * characters), and a position in a pattern is the number of tokens
+ * matched so far. The NFA state is the set of positions of all the
+ * patterns, with a '*' position also holding the one after it.
+ * The DFA states are those sets. They are created on the first
+ * transition that reaches them, and kept in a cache of at most
+ * GLOB_MAX_STATES, which is emptied when it fills up, so memory is
+ * bounded even for sets of patterns with a huge DFA.
+ * The alphabet is split into the intervals of characters that no
+ * pattern tells apart, so transitions are indexed by interval
+ * instead of by character.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str_glob.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memcmp, memcpy, memset, strlen
+#include <wchar.h>  // wcslen
+#include "util.h"
+#include "internal.h"
+
+#define GLOB_MAX_STATES 2048
+#define INITIAL_STATES 16
+
+#define DEAD    -2
+#define UNKNOWN -1
+
+enum { TOK_STAR, TOK_SET, TOK_END };
+
+struct range {
+	uint32_t lo;
+	uint32_t hi;
+};
+
+/*
+ * A TOK_SET with no ranges and negated set is '?'.
+ * For TOK_END, first is the index of the pattern.
+ */
+struct token {
+	unsigned char type;
+	unsigned char negated;
+	uint32_t first;
+	uint32_t n;
+};
+
+struct str_glob {
+	struct token *tokens;  // one per position
+	size_t n_pos;
+	size_t pos_cap;
+	struct range *ranges;
+	size_t n_ranges;
+	size_t ranges_cap;
+	size_t words;          // of a set of positions
+	uint64_t *start_set;
+	uint64_t *scratch;
+	/* Character intervals */
+	uint32_t *bounds;      // start of each interval
+	size_t n_classes;
+	uint32_t byte_class[256];
+	/* Lazy DFA */
+	uint64_t *sets;        // [cap][words]
+	int32_t *trans;        // [cap][n_classes]
+	size_t *acc_first;     // accepted patterns of each state,
+	unsigned *acc_n;       // as a slice of ids
+	size_t n_states;
+	size_t cap;
+	unsigned *ids;
+	size_t n_ids;
+	size_t ids_cap;
+	int32_t *table;        // hash of sets to states
+	size_t table_cap;
+	int32_t start;
+};
+
+static INLINE uint32_t __char(const void *s, size_t i, unsigned width){
+	switch (width){
+	case 1:  return ((const unsigned char*)s)[i];
+	case 2:  return ((const uint16_t*)s)[i];
+	default: return ((const wchar_t*)s)[i];
+	}
+}
+
+/*
+ * Parsing
+ */
+
+static void __push_token(str_glob_t *g, unsigned char type, unsigned char negated, uint32_t first, uint32_t n){
+	if (g->n_pos == g->pos_cap){
+		g->pos_cap = g->pos_cap ? g->pos_cap * 2 : 16;
+		g->tokens = realloc(g->tokens, g->pos_cap * sizeof(struct token));
+		assert(g->tokens);
+	}
+	g->tokens[g->n_pos++] = (struct token){ .type = type, .negated = negated, .first = first, .n = n };
+}
+
+static void __push_range(str_glob_t *g, uint32_t lo, uint32_t hi){
+	if (g->n_ranges == g->ranges_cap){
+		g->ranges_cap = g->ranges_cap ? g->ranges_cap * 2 : 16;
+		g->ranges = realloc(g->ranges, g->ranges_cap * sizeof(struct range));
+		assert(g->ranges);
+	}
+	g->ranges[g->n_ranges++] = (struct range){ .lo = lo, .hi = hi };
+}
+
+/*
+ * Returns the index of the ']' that closes the '[' at i, or 0 if
+ * there isn't one.
+ */
+static size_t __set_end(const void *p, size_t n, size_t i, unsigned width){
+	size_t j = i + 1;
+	if (j < n && (__char(p, j, width) == '!' || __char(p, j, width) == '^'))
+		j++;
+	if (j < n && __char(p, j, width) == ']')
+		j++;
+	for (; j < n; j++){
+		uint32_t c = __char(p, j, width);
+		if (c == ']')
+			return j;
+		if (c == '\\')
+			j++;
+	}
+	return 0;
+}
+
+static void __parse_set(str_glob_t *g, const void *p, size_t i, size_t end, unsigned width){
+	unsigned char negated = 0;
+	if (__char(p, i, width) == '!' || __char(p, i, width) == '^'){
+		negated = 1;
+		i++;
+	}
+	uint32_t first = g->n_ranges;
+	while (i < end){
+		uint32_t lo = __char(p, i, width);
+		if (lo == '\\' && i + 1 < end)
+			lo = __char(p, ++i, width);
+		i++;
+		uint32_t hi = lo;
+		if (i + 1 < end && __char(p, i, width) == '-'){
+			i++;
+			hi = __char(p, i, width);
+			if (hi == '\\' && i + 1 < end)
+				hi = __char(p, ++i, width);
+			i++;
+		}
+		if (lo <= hi)
+			__push_range(g, lo, hi);
+	}
+	__push_token(g, TOK_SET, negated, first, g->n_ranges - first);
+}
+
+static void __parse(str_glob_t *g, const void *p, size_t n, unsigned width, unsigned id){
+	int prev_star = 0;
+	for (size_t i = 0; i < n; ){
+		uint32_t c = __char(p, i, width);
+		size_t end;
+		if (c == '*'){
+			if (!prev_star)
+				__push_token(g, TOK_STAR, 0, 0, 0);
+			prev_star = 1;
+			i++;
+			continue;
+		}
+		prev_star = 0;
+		if (c == '?'){
+			__push_token(g, TOK_SET, 1, 0, 0);
+			i++;
+		} else if (c == '[' && (end = __set_end(p, n, i, width)) != 0){
+			__parse_set(g, p, i + 1, end, width);
+			i = end + 1;
+		} else {
+			if (c == '\\' && i + 1 < n)
+				c = __char(p, ++i, width);
+			__push_token(g, TOK_SET, 0, g->n_ranges, 1);
+			__push_range(g, c, c);
+			i++;
+		}
+	}
+	__push_token(g, TOK_END, 0, id, 0);
+}
+
+static int __cmp_u32(const void *a, const void *b){
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+	return (x > y) - (x < y);
+}
+
+/*
+ * Splits the characters into intervals, so that every range starts
+ * and ends at an interval boundary.
+ */
+static void __build_classes(str_glob_t *g){
+	g->bounds = malloc((2 * g->n_ranges + 1) * sizeof(uint32_t));
+	assert(g->bounds);
+	size_t n = 0;
+	g->bounds[n++] = 0;
+	for (size_t i = 0; i < g->n_ranges; i++){
+		g->bounds[n++] = g->ranges[i].lo;
+		if (g->ranges[i].hi < UINT32_MAX)
+			g->bounds[n++] = g->ranges[i].hi + 1;
+	}
+	qsort(g->bounds, n, sizeof(uint32_t), __cmp_u32);
+	size_t k = 1;
+	for (size_t i = 1; i < n; i++){
+		if (g->bounds[i] != g->bounds[k - 1])
+			g->bounds[k++] = g->bounds[i];
+	}
+	g->n_classes = k;
+	size_t cls = 0;
+	for (uint32_t c = 0; c < 256; c++){
+		while (cls + 1 < k && g->bounds[cls + 1] <= c)
+			cls++;
+		g->byte_class[c] = cls;
+	}
+}
+
+static INLINE size_t __class_of(const str_glob_t *g, uint32_t c){
+	if (c < 256)
+		return g->byte_class[c];
+	size_t lo = 0, hi = g->n_classes;
+	while (hi - lo > 1){
+		size_t mid = (lo + hi) / 2;
+		if (g->bounds[mid] <= c)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+/*
+ * DFA
+ */
+
+static INLINE void __add_pos(const str_glob_t *g, uint64_t *set, size_t i){
+	set[i / 64] |= 1ULL << (i % 64);
+	while (g->tokens[i].type == TOK_STAR){
+		i++;
+		set[i / 64] |= 1ULL << (i % 64);
+	}
+}
+
+static int __accepts(const str_glob_t *g, const struct token *t, uint32_t c){
+	int in = 0;
+	for (uint32_t r = t->first; r < t->first + t->n && !in; r++)
+		in = g->ranges[r].lo <= c && c <= g->ranges[r].hi;
+	return in != t->negated;
+}
+
+static uint64_t __hash(const uint64_t *set, size_t words){
+	uint64_t h = 0x9E3779B97F4A7C15ULL;
+	for (size_t i = 0; i < words; i++)
+		h = (h ^ set[i]) * 0xFF51AFD7ED558CCDULL;
+	return h ^ (h >> 32);
+}
+
+static void __flush(str_glob_t *g){
+	g->n_states = 0;
+	g->n_ids = 0;
+	for (size_t i = 0; i < g->table_cap; i++)
+		g->table[i] = -1;
+}
+
+static void __grow(str_glob_t *g){
+	g->cap = g->cap ? g->cap * 2 : INITIAL_STATES;
+	g->sets = realloc(g->sets, g->cap * g->words * sizeof(uint64_t));
+	g->trans = realloc(g->trans, g->cap * g->n_classes * sizeof(int32_t));
+	g->acc_first = realloc(g->acc_first, g->cap * sizeof(size_t));
+	g->acc_n = realloc(g->acc_n, g->cap * sizeof(unsigned));
+	assert(g->sets && g->trans && g->acc_first && g->acc_n);
+	/* The table is kept at most half full */
+	free(g->table);
+	g->table_cap = g->cap * 2;
+	g->table = malloc(g->table_cap * sizeof(int32_t));
+	assert(g->table);
+	for (size_t i = 0; i < g->table_cap; i++)
+		g->table[i] = -1;
+	for (size_t s = 0; s < g->n_states; s++){
+		size_t h = __hash(&g->sets[s * g->words], g->words) & (g->table_cap - 1);
+		while (g->table[h] >= 0)
+			h = (h + 1) & (g->table_cap - 1);
+		g->table[h] = s;
+	}
+}
+
+static void __push_id(str_glob_t *g, unsigned id){
+	if (g->n_ids == g->ids_cap){
+		g->ids_cap = g->ids_cap ? g->ids_cap * 2 : 16;
+		g->ids = realloc(g->ids, g->ids_cap * sizeof(unsigned));
+		assert(g->ids);
+	}
+	g->ids[g->n_ids++] = id;
+}
+
+/*
+ * Gets the state of the given set, creating it if needed.
+ * @return the state, or -1 if the cache is full
+ */
+static int32_t __state(str_glob_t *g, const uint64_t *set){
+	size_t words = g->words;
+	size_t h = g->table_cap ? __hash(set, words) & (g->table_cap - 1) : 0;
+	for (; g->table_cap && g->table[h] >= 0; h = (h + 1) & (g->table_cap - 1)){
+		int32_t s = g->table[h];
+		if (memcmp(&g->sets[s * words], set, words * sizeof(uint64_t)) == 0)
+			return s;
+	}
+	if (g->n_states == GLOB_MAX_STATES)
+		return -1;
+	if (g->n_states == g->cap){
+		__grow(g);
+		h = __hash(set, words) & (g->table_cap - 1);
+		while (g->table[h] >= 0)
+			h = (h + 1) & (g->table_cap - 1);
+	}
+	int32_t s = g->n_states++;
+	g->table[h] = s;
+	memcpy(&g->sets[s * words], set, words * sizeof(uint64_t));
+	for (size_t c = 0; c < g->n_classes; c++)
+		g->trans[s * g->n_classes + c] = UNKNOWN;
+	g->acc_first[s] = g->n_ids;
+	for (size_t w = 0; w < words; w++){
+		for (uint64_t bits = set[w]; bits; bits &= bits - 1){
+			const struct token *t = &g->tokens[w * 64 + __builtin_ctzll(bits)];
+			if (t->type == TOK_END)
+				__push_id(g, t->first);
+		}
+	}
+	g->acc_n[s] = g->n_ids - g->acc_first[s];
+	return s;
+}
+
+/*
+ * Computes the transition of state s with the characters of class cls.
+ */
+static int32_t __step(str_glob_t *g, int32_t s, size_t cls){
+	size_t words = g->words;
+	uint32_t c = g->bounds[cls];
+	uint64_t *next = g->scratch;
+	memset(next, 0, words * sizeof(uint64_t));
+	int empty = 1;
+	for (size_t w = 0; w < words; w++){
+		for (uint64_t bits = g->sets[s * words + w]; bits; bits &= bits - 1){
+			size_t i = w * 64 + __builtin_ctzll(bits);
+			const struct token *t = &g->tokens[i];
+			if (t->type == TOK_STAR){
+				__add_pos(g, next, i);
+				empty = 0;
+			} else if (t->type == TOK_SET && __accepts(g, t, c)){
+				__add_pos(g, next, i + 1);
+				empty = 0;
+			}
+		}
+	}
+	if (empty){
+		g->trans[s * g->n_classes + cls] = DEAD;
+		return DEAD;
+	}
+	int32_t n = __state(g, next);
+	if (n < 0){
+		/* s doesn't survive the flush, so the transition isn't stored */
+		__flush(g);
+		g->start = __state(g, g->start_set);
+		return __state(g, next);
+	}
+	g->trans[s * g->n_classes + cls] = n;
+	return n;
+}
+
+static int32_t __run(str_glob_t *g, const void *s, size_t n, unsigned width){
+	int32_t st = g->start;
+	for (size_t i = 0; i < n; i++){
+		size_t cls = __class_of(g, __char(s, i, width));
+		int32_t next = g->trans[st * g->n_classes + cls];
+		if (next == UNKNOWN)
+			next = __step(g, st, cls);
+		if (next == DEAD)
+			return DEAD;
+		st = next;
+	}
+	return st;
+}
+
+static str_glob_t* __compile(const void **patterns, size_t n, unsigned width){
+	if (!patterns)
+		return NULL;
+	for (size_t i = 0; i < n; i++){
+		if (!patterns[i])
+			return NULL;
+	}
+	str_glob_t *g = calloc(1, sizeof(*g));
+	assert(g);
+	for (size_t i = 0; i < n; i++){
+		size_t len = width == 1 ? strlen(patterns[i]) : wcslen(patterns[i]);
+		__parse(g, patterns[i], len, width, i);
+	}
+	/* Padding position, so sets are never empty of words */
+	g->words = g->n_pos / 64 + 1;
+	g->start_set = calloc(g->words, sizeof(uint64_t));
+	g->scratch = malloc(g->words * sizeof(uint64_t));
+	assert(g->start_set && g->scratch);
+	for (size_t i = 0, at = 0; i < n; i++){
+		__add_pos(g, g->start_set, at);
+		while (g->tokens[at].type != TOK_END)
+			at++;
+		at++;
+	}
+	__build_classes(g);
+	g->start = __state(g, g->start_set);
+	return g;
+}
+
+str_glob_t* str_glob_compile(const char *pattern){
+	return str_glob_compile_set(&pattern, 1);
+}
+
+str_glob_t* str_glob_compile_set(const char **patterns, size_t n){
+	return __compile((const void**)patterns, n, 1);
+}
+
+str_glob_t* wstr_glob_compile(const wchar_t *pattern){
+	return wstr_glob_compile_set(&pattern, 1);
+}
+
+str_glob_t* wstr_glob_compile_set(const wchar_t **patterns, size_t n){
+	return __compile((const void**)patterns, n, sizeof(wchar_t));
+}
+
+int str_glob_match_view(str_glob_t *glob, str_view_t view){
+	if (!glob || !view.buf)
+		return -1;
+	int32_t st = __run(glob, view.buf, view.len, 1);
+	return st != DEAD && glob->acc_n[st] > 0;
+}
+
+int str_glob_match(str_glob_t *glob, const string_t *str){
+	if (!glob || !str)
+		return -1;
+	return str_glob_match_view(glob, str_as_view(str));
+}
+
+int wstr_glob_match(str_glob_t *glob, const wstring_t *wstr){
+	if (!glob || !wstr)
+		return -1;
+	int32_t st = __run(glob, wstr->buffer, wstr->length, wstr->char_size);
+	return st != DEAD && glob->acc_n[st] > 0;
+}
+
+static int __which(str_glob_t *glob, int32_t st, const unsigned **ids){
+	if (st == DEAD){
+		*ids = NULL;
+		return 0;
+	}
+	*ids = &glob->ids[glob->acc_first[st]];
+	return glob->acc_n[st];
+}
+
+int str_glob_which(str_glob_t *glob, const string_t *str, const unsigned **ids){
+	if (!glob || !str || !ids)
+		return -1;
+	return __which(glob, __run(glob, str->buffer, str->length, 1), ids);
+}
+
+int wstr_glob_which(str_glob_t *glob, const wstring_t *wstr, const unsigned **ids){
+	if (!glob || !wstr || !ids)
+		return -1;
+	return __which(glob, __run(glob, wstr->buffer, wstr->length, wstr->char_size), ids);
+}
+
+void str_glob_free(str_glob_t *glob){
+	if (glob){
+		free(glob->tokens);
+		free(glob->ranges);
+		free(glob->start_set);
+		free(glob->scratch);
+		free(glob->bounds);
+		free(glob->sets);
+		free(glob->trans);
+		free(glob->acc_first);
+		free(glob->acc_n);
+		free(glob->ids);
+		free(glob->table);
+		free(glob);
+	}
+}
@@ -0,0 +1,83 @@
+/*
+ * str_glob.h - str_glob_t definition.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * A str_glob_t is one shell-style pattern, or a set of them, compiled
+ * to a DFA. Patterns support:
+ *   *        any sequence of characters, including the empty one
+ *   ?        any character
+ *   [abc]    any of the characters, with ranges like [a-z]
+ *   [!abc]   any character but those ([^abc] works too)
+ *   \c       the character c
+ * A ']' right after the '[' (or the '!') is part of the set, and a '['
+ * without a closing ']' is taken literally.
+ * The DFA states are built lazily, as matching needs them, so each
+ * character of the input costs a table lookup once the DFA is warm,
+ * and matching takes linear time whatever the patterns are.
+ */
+#pragma once
+#ifndef STR_GLOB_H
+#define STR_GLOB_H
+
+#include "str.h"
+#include "wstr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct str_glob str_glob_t;
+
+/**
+ * Compiles a pattern.
+ * string_ts are matched byte by byte, so '?' matches a single byte
+ * of a UTF-8 sequence.
+ * @return the compiled pattern, or NULL if pattern is NULL
+ */
+str_glob_t* str_glob_compile(const char *pattern);
+
+/**
+ * Compiles a set of n patterns into a single DFA, that matches them
+ * all in one pass. The patterns are identified by their index.
+ * @return the compiled set, or NULL if patterns or any of them are NULL
+ */
+str_glob_t* str_glob_compile_set(const char **patterns, size_t n);
+
+/**
+ * Same as str_glob_compile and str_glob_compile_set, for patterns of
+ * wchar_t, which are matched character by character.
+ */
+str_glob_t* wstr_glob_compile(const wchar_t *pattern);
+str_glob_t* wstr_glob_compile_set(const wchar_t **patterns, size_t n);
+
+/**
+ * Checks if the whole string matches any of the patterns of glob.
+ * Any str_glob_t can match both string_ts and wstring_ts.
+ * @return 1 if it does, 0 if not, -1 if glob or str are NULL
+ * @note Matching builds the DFA, so a str_glob_t must not be used
+ *       from more than one thread at a time.
+ */
+int str_glob_match(str_glob_t *glob, const string_t *str);
+int str_glob_match_view(str_glob_t *glob, str_view_t view);
+int wstr_glob_match(str_glob_t *glob, const wstring_t *wstr);
+
+/**
+ * Finds all the patterns of glob that match the whole string.
+ * @param ids set to an array, in ascending order, with the indexes of
+ *        the matching patterns. It's owned by glob, and only valid
+ *        until the next match on it.
+ * @return the number of matching patterns, or -1 if an argument is NULL
+ */
+int str_glob_which(str_glob_t *glob, const string_t *str, const unsigned **ids);
+int wstr_glob_which(str_glob_t *glob, const wstring_t *wstr, const unsigned **ids);
+
+/**
+ * Frees the str_glob_t
+ */
+void str_glob_free(str_glob_t *glob);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STR_GLOB_H
@@ -0,0 +1,87 @@
+/*
+ * str_inline.h - Inline accessors of string_t.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Included by str.h when STR_INLINE is defined before including it.
+ * This exposes the layout of string_t, so code built this way must be
+ * rebuilt whenever the library changes it.
+ */
+#ifndef STR_INLINE_H
+#define STR_INLINE_H
+
+#include <stddef.h>
+#include "str.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct utf8_index;
+
+/*
+ * buffer has room for buffer_size + 1 chars, and buffer[length]
+ * is always '\0'.
+ */
+struct string {
+        char    *buffer;
+        size_t  length;
+        size_t  buffer_size;
+        struct utf8_index *utf8;
+};
+
+#ifdef __GNUC__
+#define __STR_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define __STR_UNLIKELY(x) (x)
+#endif
+
+/*
+ * Each of these behaves exactly like the function it replaces, and
+ * calls it for the cases that need the library: growing the buffer,
+ * or invalidating the UTF-8 index of the string.
+ * Appending never invalidates the index, so push_char doesn't care.
+ */
+
+static inline int __str_push_char_inline(string_t *str, char c){
+	if (__STR_UNLIKELY(!str || str->length == str->buffer_size))
+		return (str_push_char)(str, c);
+	str->buffer[str->length++] = c;
+	str->buffer[str->length] = '\0';
+	return 1;
+}
+
+static inline char __str_get_at_inline(const string_t *str, unsigned index){
+	if (__STR_UNLIKELY(!str))
+		return -1;
+	if (__STR_UNLIKELY(index >= str->length))
+		return -2;
+	return str->buffer[index];
+}
+
+static inline int __str_set_at_inline(string_t *str, unsigned index, char c){
+	if (__STR_UNLIKELY(!str || str->utf8))
+		return (str_set_at)(str, index, c);
+	if (__STR_UNLIKELY(index >= str->length))
+		return -2;
+	return str->buffer[index] = c;
+}
+
+static inline const char* __str_get_buffer_inline(const string_t *str){
+	return str ? str->buffer : NULL;
+}
+
+static inline size_t __str_length_inline(const string_t *str){
+	return str ? str->length : 0;
+}
+
+#define str_push_char(str, c)     __str_push_char_inline(str, c)
+#define str_get_at(str, index)    __str_get_at_inline(str, index)
+#define str_set_at(str, index, c) __str_set_at_inline(str, index, c)
+#define str_get_buffer(str)       __str_get_buffer_inline(str)
+#define str_length(str)           __str_length_inline(str)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,439 @@
+/*
+ * str_map.c - str_map_t implementation.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Each slot has a control byte: EMPTY, DELETED, or the low 7 bits of
+ * the key's hash (h2) if it's full. The rest of the hash (h1) picks the
+ * group of 16 slots where probing starts. A group's control bytes are
+ * compared with h2 in one SSE2 instruction, so only the slots that
+ * match are compared with the key, and a group with an EMPTY slot ends
+ * the probe. The first GROUP control bytes are mirrored after the last
+ * one, so a group can be loaded from any slot without wrapping around.
+ * The keys live in the arena, each followed by a '\0'. Removed keys
+ * are left there as garbage, until the arena is compacted.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str_map.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memcpy, memcmp, memset, strnlen
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "util.h"
+#include "internal.h"
+
+#define GROUP 16
+#define EMPTY   0x80
+#define DELETED 0xFE
+#define INITIAL_CHARS 256
+#ifndef GROW_FACTOR
+#define GROW_FACTOR 2
+#endif
+
+struct slot {
+	uint64_t hash;
+	size_t   offset;
+	size_t   len;
+	void    *value;
+};
+
+struct str_map {
+	unsigned char *ctrl;
+	struct slot   *slots;
+	size_t cap;         // number of slots, a power of 2
+	size_t count;
+	size_t growth_left; // EMPTY slots that can be filled before rehashing
+	char  *arena;
+	size_t arena_length;
+	size_t arena_size;
+	size_t garbage;     // chars of removed keys in the arena
+};
+
+/* The load factor is kept under 7/8 */
+static INLINE size_t __max_load(size_t cap){
+	return cap - cap / 8;
+}
+
+#define H_PRIME1 0x9E3779B97F4A7C15ULL
+#define H_PRIME2 0xC2B2AE3D27D4EB4FULL
+
+static INLINE uint64_t __load64(const char *p){
+	uint64_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static INLINE uint64_t __mix(uint64_t hash, uint64_t word){
+	hash ^= word * H_PRIME2;
+	hash = (hash << 31) | (hash >> 33);
+	return hash * H_PRIME1;
+}
+
+static uint64_t __hash(const char *key, size_t len){
+	uint64_t hash = len * H_PRIME1;
+	const char *p = key;
+	for (size_t n = len; n >= 8; n -= 8, p += 8)
+		hash = __mix(hash, __load64(p));
+	size_t tail = len % 8;
+	if (tail > 0){
+		uint64_t word = 0;
+		memcpy(&word, p, tail);
+		hash = __mix(hash, word);
+	}
+	hash ^= hash >> 33;
+	hash *= H_PRIME2;
+	hash ^= hash >> 29;
+	hash *= H_PRIME1;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+static INLINE unsigned char __h2(uint64_t hash){
+	return hash & 0x7F;
+}
+
+static INLINE size_t __h1(uint64_t hash){
+	return hash >> 7;
+}
+
+/* Bitmask of the slots in the group at ctrl whose byte is c */
+static INLINE unsigned __match(const unsigned char *ctrl, unsigned char c){
+#ifdef __SSE2__
+	__m128i g = _mm_loadu_si128((const __m128i*)ctrl);
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(c)));
+#else
+	unsigned mask = 0;
+	for (int i = 0; i < GROUP; i++)
+		mask |= (unsigned)(ctrl[i] == c) << i;
+	return mask;
+#endif
+}
+
+/* Bitmask of the EMPTY or DELETED slots in the group at ctrl */
+static INLINE unsigned __match_free(const unsigned char *ctrl){
+#ifdef __SSE2__
+	return _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctrl));
+#else
+	unsigned mask = 0;
+	for (int i = 0; i < GROUP; i++)
+		mask |= (unsigned)(ctrl[i] >> 7) << i;
+	return mask;
+#endif
+}
+
+static INLINE void __set_ctrl(str_map_t *map, size_t i, unsigned char c){
+	map->ctrl[i] = c;
+	if (i < GROUP)
+		map->ctrl[map->cap + i] = c;
+}
+
+/*
+ * Finds the slot of the given key.
+ * Groups are probed triangularly, which visits all of them when the
+ * number of slots is a power of 2.
+ * @return the index of the slot, or -1 if the key is not in the map
+ */
+static long __find(const str_map_t *map, const char *key, size_t len, uint64_t hash){
+	size_t mask = map->cap - 1;
+	size_t pos = __h1(hash) & mask;
+	unsigned char h2 = __h2(hash);
+	for (size_t stride = GROUP; ; stride += GROUP){
+		const unsigned char *group = &map->ctrl[pos];
+		for (unsigned m = __match(group, h2); m != 0; m &= m - 1){
+			size_t i = (pos + __builtin_ctz(m)) & mask;
+			const struct slot *s = &map->slots[i];
+			if (s->hash == hash && s->len == len
+			    && memcmp(&map->arena[s->offset], key, len) == 0)
+				return i;
+		}
+		if (__match(group, EMPTY) != 0)
+			return -1;
+		pos = (pos + stride) & mask;
+	}
+}
+
+/* Finds the first EMPTY or DELETED slot in the probe sequence of hash */
+static size_t __find_free(const str_map_t *map, uint64_t hash){
+	size_t mask = map->cap - 1;
+	size_t pos = __h1(hash) & mask;
+	for (size_t stride = GROUP; ; stride += GROUP){
+		unsigned m = __match_free(&map->ctrl[pos]);
+		if (m != 0)
+			return (pos + __builtin_ctz(m)) & mask;
+		pos = (pos + stride) & mask;
+	}
+}
+
+/* Copies the live keys to a new arena, dropping the garbage */
+static void __compact(str_map_t *map){
+	char *arena = malloc(map->arena_size * sizeof(char));
+	assert(arena);
+	size_t length = 0;
+	for (size_t i = 0; i < map->cap; i++){
+		if (map->ctrl[i] & 0x80)
+			continue;
+		struct slot *s = &map->slots[i];
+		memcpy(&arena[length], &map->arena[s->offset], (s->len + 1) * sizeof(char));
+		s->offset = length;
+		length += s->len + 1;
+	}
+	free(map->arena);
+	map->arena = arena;
+	map->arena_length = length;
+	map->garbage = 0;
+}
+
+static void __rehash(str_map_t *map, size_t new_cap){
+	unsigned char *old_ctrl = map->ctrl;
+	struct slot *old_slots = map->slots;
+	size_t old_cap = map->cap;
+	map->cap = new_cap;
+	map->ctrl = malloc((new_cap + GROUP) * sizeof(unsigned char));
+	map->slots = malloc(new_cap * sizeof(struct slot));
+	assert(map->ctrl && map->slots);
+	memset(map->ctrl, EMPTY, new_cap + GROUP);
+	for (size_t i = 0; i < old_cap; i++){
+		if (old_ctrl[i] & 0x80)
+			continue;
+		size_t j = __find_free(map, old_slots[i].hash);
+		__set_ctrl(map, j, old_ctrl[i]);
+		map->slots[j] = old_slots[i];
+	}
+	map->growth_left = __max_load(new_cap) - map->count;
+	free(old_ctrl);
+	free(old_slots);
+}
+
+/* Makes room for one more key, dropping the DELETED slots */
+static void __grow(str_map_t *map){
+	size_t cap = map->cap;
+	/* If most of the load is DELETED slots, rehashing in place is enough */
+	if (map->count > __max_load(cap) / 2)
+		cap *= 2;
+	__rehash(map, cap);
+}
+
+/*
+ * Makes room for n more chars in the arena.
+ * @param keep a key being inserted, that may point into the arena
+ */
+static void __reserve_arena(str_map_t *map, size_t n, const char **keep){
+	if (map->arena_length + n <= map->arena_size)
+		return;
+	uintptr_t keep_off = (uintptr_t)*keep - (uintptr_t)map->arena;
+	int aliased = keep_off < map->arena_size;
+	if (!aliased && map->garbage > 0 && map->garbage >= map->arena_length / 2){
+		__compact(map);
+		if (map->arena_length + n <= map->arena_size)
+			return;
+	}
+	size_t new_size = map->arena_size * GROW_FACTOR;
+	if (map->arena_length + n > new_size)
+		new_size = map->arena_length + n;
+	map->arena_size = new_size;
+	map->arena = realloc(map->arena, new_size * sizeof(char));
+	assert(map->arena);
+	if (aliased)
+		*keep = map->arena + keep_off;
+}
+
+/* Smallest power of 2 number of slots that holds n keys */
+static size_t __cap_for(size_t n){
+	size_t cap = GROUP;
+	while (__max_load(cap) < n)
+		cap *= 2;
+	return cap;
+}
+
+str_map_t* str_map_init(size_t n, size_t n_chars){
+	str_map_t *map = malloc(sizeof(*map));
+	assert(map);
+	map->cap = __cap_for(n);
+	map->count = 0;
+	map->growth_left = __max_load(map->cap);
+	map->ctrl = malloc((map->cap + GROUP) * sizeof(unsigned char));
+	map->slots = malloc(map->cap * sizeof(struct slot));
+	assert(map->ctrl && map->slots);
+	memset(map->ctrl, EMPTY, map->cap + GROUP);
+	map->arena_size = n_chars + n;
+	if (map->arena_size == 0)
+		map->arena_size = INITIAL_CHARS;
+	map->arena = malloc(map->arena_size * sizeof(char));
+	assert(map->arena);
+	map->arena_length = 0;
+	map->garbage = 0;
+	return map;
+}
+
+str_map_t* str_map_empty(void){
+	return str_map_init(0, 0);
+}
+
+void str_map_reserve(str_map_t *map, size_t n, size_t n_chars){
+	if (!map)
+		return;
+	size_t cap = __cap_for(n);
+	if (cap > map->cap)
+		__rehash(map, cap);
+	if (n_chars + n > map->arena_size){
+		map->arena_size = n_chars + n;
+		map->arena = realloc(map->arena, map->arena_size * sizeof(char));
+		assert(map->arena);
+	}
+}
+
+static int __put(str_map_t *map, const char *key, size_t len, void *value){
+	uint64_t hash = __hash(key, len);
+	long found = __find(map, key, len, hash);
+	if (found >= 0){
+		map->slots[found].value = value;
+		return 0;
+	}
+	size_t i = __find_free(map, hash);
+	if (map->ctrl[i] == EMPTY && map->growth_left == 0){
+		__grow(map);
+		i = __find_free(map, hash);
+	}
+	__reserve_arena(map, len + 1, &key);
+	if (map->ctrl[i] == EMPTY)
+		map->growth_left--;
+	__set_ctrl(map, i, __h2(hash));
+	map->slots[i] = (struct slot){
+		.hash = hash,
+		.offset = map->arena_length,
+		.len = len,
+		.value = value
+	};
+	memcpy(&map->arena[map->arena_length], key, len * sizeof(char));
+	map->arena[map->arena_length + len] = '\0';
+	map->arena_length += len + 1;
+	map->count++;
+	return 1;
+}
+
+int str_map_put_cstr(str_map_t *map, const char *key, unsigned n, void *value){
+	if (!map || !key)
+		return -1;
+	return __put(map, key, strnlen(key, n), value);
+}
+
+int str_map_put_str(str_map_t *map, const string_t *key, void *value){
+	if (!map || !key)
+		return -1;
+	return __put(map, key->buffer, key->length, value);
+}
+
+int str_map_put_view(str_map_t *map, str_view_t key, void *value){
+	if (!map || !key.buf)
+		return -1;
+	return __put(map, key.buf, key.len, value);
+}
+
+static void** __find_value(const str_map_t *map, const char *key, size_t len){
+	long i = __find(map, key, len, __hash(key, len));
+	return i >= 0 ? &map->slots[i].value : NULL;
+}
+
+void** str_map_find_cstr(const str_map_t *map, const char *key, unsigned n){
+	if (!map || !key)
+		return NULL;
+	return __find_value(map, key, strnlen(key, n));
+}
+
+void** str_map_find_str(const str_map_t *map, const string_t *key){
+	if (!map || !key)
+		return NULL;
+	return __find_value(map, key->buffer, key->length);
+}
+
+void** str_map_find_view(const str_map_t *map, str_view_t key){
+	if (!map || !key.buf)
+		return NULL;
+	return __find_value(map, key.buf, key.len);
+}
+
+void* str_map_get_cstr(const str_map_t *map, const char *key, unsigned n){
+	void **value = str_map_find_cstr(map, key, n);
+	return value ? *value : NULL;
+}
+
+void* str_map_get_str(const str_map_t *map, const string_t *key){
+	void **value = str_map_find_str(map, key);
+	return value ? *value : NULL;
+}
+
+void* str_map_get_view(const str_map_t *map, str_view_t key){
+	void **value = str_map_find_view(map, key);
+	return value ? *value : NULL;
+}
+
+static int __remove(str_map_t *map, const char *key, size_t len){
+	long i = __find(map, key, len, __hash(key, len));
+	if (i < 0)
+		return 0;
+	__set_ctrl(map, i, DELETED);
+	map->garbage += map->slots[i].len + 1;
+	map->count--;
+	return 1;
+}
+
+int str_map_remove_cstr(str_map_t *map, const char *key, unsigned n){
+	if (!map || !key)
+		return -1;
+	return __remove(map, key, strnlen(key, n));
+}
+
+int str_map_remove_str(str_map_t *map, const string_t *key){
+	if (!map || !key)
+		return -1;
+	return __remove(map, key->buffer, key->length);
+}
+
+int str_map_remove_view(str_map_t *map, str_view_t key){
+	if (!map || !key.buf)
+		return -1;
+	return __remove(map, key.buf, key.len);
+}
+
+size_t str_map_count(const str_map_t *map){
+	return map ? map->count : 0;
+}
+
+int str_map_next(const str_map_t *map, size_t *it, str_view_t *key, void **value){
+	if (!map || !it)
+		return 0;
+	for (size_t i = *it; i < map->cap; i++){
+		if (map->ctrl[i] & 0x80)
+			continue;
+		const struct slot *s = &map->slots[i];
+		if (key)
+			*key = (str_view_t){ .buf = &map->arena[s->offset], .len = s->len };
+		if (value)
+			*value = s->value;
+		*it = i + 1;
+		return 1;
+	}
+	*it = map->cap;
+	return 0;
+}
+
+void str_map_clear(str_map_t *map){
+	if (!map)
+		return;
+	memset(map->ctrl, EMPTY, map->cap + GROUP);
+	map->count = 0;
+	map->growth_left = __max_load(map->cap);
+	map->arena_length = 0;
+	map->garbage = 0;
+}
+
+void str_map_free(str_map_t *map){
+	if (map){
+		free(map->ctrl);
+		free(map->slots);
+		free(map->arena);
+		free(map);
+	}
+}
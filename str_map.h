@@ -0,0 +1,116 @@
+/*
+ * str_map.h - str_map_t definition.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * A str_map_t maps strings to void* values. It's an open addressing
+ * hash table in the style of SwissTable: a byte of metadata per slot
+ * lets a lookup check 16 slots at once, and the keys are copied to a
+ * single arena, so the map doesn't allocate per key.
+ * Lookups take a C string, a string_t or a view, without building
+ * a string_t for the key.
+ */
+#pragma once
+#ifndef STR_MAP_H
+#define STR_MAP_H
+
+#include "str.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct str_map str_map_t;
+
+/**
+ * Builds an empty str_map_t
+ */
+str_map_t* str_map_empty(void);
+
+/**
+ * Builds a str_map_t with space for n keys and n_chars chars of keys
+ * in total, so inserting them doesn't need to rehash.
+ */
+str_map_t* str_map_init(size_t n, size_t n_chars);
+
+/**
+ * Reserves space for n keys and n_chars chars of keys in total
+ */
+void str_map_reserve(str_map_t *map, size_t n, size_t n_chars);
+
+/**
+ * Maps a copy of key to value. If key was already in the map, its
+ * value is replaced.
+ * @param n max length of cstr
+ * @return 1 if the key was inserted, 0 if it was already there,
+ *         -1 if map or key are NULL
+ */
+int str_map_put_cstr(str_map_t *map, const char *key, unsigned n, void *value);
+int str_map_put_str(str_map_t *map, const string_t *key, void *value);
+int str_map_put_view(str_map_t *map, str_view_t key, void *value);
+
+/**
+ * Returns the value mapped to key.
+ * @param n max length of cstr
+ * @return the value, or NULL if the key is not in the map.
+ *         Use str_map_find to tell a missing key from a NULL value.
+ */
+void* str_map_get_cstr(const str_map_t *map, const char *key, unsigned n);
+void* str_map_get_str(const str_map_t *map, const string_t *key);
+void* str_map_get_view(const str_map_t *map, str_view_t key);
+
+/**
+ * Finds the value mapped to key.
+ * @param n max length of cstr
+ * @return a pointer to the value, that can be used to change it,
+ *         or NULL if the key is not in the map.
+ * @note The pointer is invalidated by inserting into the map
+ */
+void** str_map_find_cstr(const str_map_t *map, const char *key, unsigned n);
+void** str_map_find_str(const str_map_t *map, const string_t *key);
+void** str_map_find_view(const str_map_t *map, str_view_t key);
+
+/**
+ * Removes key from the map.
+ * @param n max length of cstr
+ * @return 1 if the key was removed, 0 if it wasn't in the map,
+ *         -1 if map or key are NULL
+ */
+int str_map_remove_cstr(str_map_t *map, const char *key, unsigned n);
+int str_map_remove_str(str_map_t *map, const string_t *key);
+int str_map_remove_view(str_map_t *map, str_view_t key);
+
+/**
+ * Returns the number of keys in the map
+ */
+size_t str_map_count(const str_map_t *map);
+
+/**
+ * Iterates over the entries of the map, in no particular order.
+ * Usage:
+ *   size_t it = 0;
+ *   str_view_t key;
+ *   void *value;
+ *   while (str_map_next(map, &it, &key, &value))
+ *       ...
+ * The key's buffer is NULL terminated. key and value can be NULL.
+ * Removing the current entry while iterating is allowed, inserting
+ * is not.
+ * @return 1 if an entry was returned, 0 at the end
+ */
+int str_map_next(const str_map_t *map, size_t *it, str_view_t *key, void **value);
+
+/**
+ * Removes all the entries of the map, keeping its memory
+ */
+void str_map_clear(str_map_t *map);
+
+/**
+ * Frees the str_map_t. The values are not freed.
+ */
+void str_map_free(str_map_t *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STR_MAP_H
@@ -0,0 +1,353 @@
+/*
+ * str_pack.c - str_pack_t implementation.
+ * Author: Saúl Valdelvira (2023)
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str_pack.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h> // memcmp
+#include <errno.h>
+#include <fcntl.h>    // open
+#include <unistd.h>   // close
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // fstat
+#include <sys/uio.h>  // writev
+#include "util.h"
+#include "internal.h"
+
+#define MAGIC "STRPACK1"
+#define MAGIC_SIZE 8
+#define HEADER_SIZE 32
+
+/* Byte order of the data, stored in the header after the char size */
+#define ORDER_LE 0
+#define ORDER_BE 1
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define HOST_ORDER ORDER_BE
+#else
+#define HOST_ORDER ORDER_LE
+#endif
+#define IOV_BATCH 512
+
+struct str_pack {
+	const unsigned char *map;
+	size_t size;
+	size_t count;
+	uint32_t char_size;
+	const unsigned char *offsets;
+	const unsigned char *data;
+	size_t data_chars;
+};
+
+static INLINE void __put_le32(unsigned char *p, uint32_t v){
+	for (int i = 0; i < 4; i++)
+		p[i] = v >> (8 * i);
+}
+
+static INLINE void __put_le64(unsigned char *p, uint64_t v){
+	for (int i = 0; i < 8; i++)
+		p[i] = v >> (8 * i);
+}
+
+static INLINE uint32_t __get_le32(const unsigned char *p){
+	uint32_t v = 0;
+	for (int i = 3; i >= 0; i--)
+		v = v << 8 | p[i];
+	return v;
+}
+
+static INLINE uint64_t __get_le64(const unsigned char *p){
+	uint64_t v = 0;
+	for (int i = 7; i >= 0; i--)
+		v = v << 8 | p[i];
+	return v;
+}
+
+/*
+ * Streaming 64 bit checksum. The input is consumed as little endian
+ * words, so the result doesn't depend on how it's split into chunks.
+ */
+struct checksum {
+	uint64_t hash;
+	uint64_t pending;
+	unsigned n_pending;
+	uint64_t total;
+};
+
+#define CK_PRIME1 0x9E3779B97F4A7C15ULL
+#define CK_PRIME2 0xC2B2AE3D27D4EB4FULL
+
+static INLINE uint64_t __mix(uint64_t hash, uint64_t word){
+	hash ^= word * CK_PRIME2;
+	hash = (hash << 31) | (hash >> 33);
+	return hash * CK_PRIME1;
+}
+
+static void __checksum_update(struct checksum *ck, const void *buf, size_t n){
+	const unsigned char *p = buf;
+	ck->total += n;
+	while (n > 0 && ck->n_pending > 0){
+		ck->pending |= (uint64_t)*p++ << (8 * ck->n_pending);
+		n--;
+		if (++ck->n_pending == 8){
+			ck->hash = __mix(ck->hash, ck->pending);
+			ck->pending = 0;
+			ck->n_pending = 0;
+		}
+	}
+	for (; n >= 8; n -= 8, p += 8)
+		ck->hash = __mix(ck->hash, __get_le64(p));
+	for (; n > 0; n--)
+		ck->pending |= (uint64_t)*p++ << (8 * ck->n_pending++);
+}
+
+static uint64_t __checksum_final(struct checksum *ck){
+	uint64_t hash = ck->hash;
+	if (ck->n_pending > 0)
+		hash = __mix(hash, ck->pending);
+	hash ^= ck->total;
+	hash ^= hash >> 33;
+	hash *= CK_PRIME2;
+	hash ^= hash >> 29;
+	return hash;
+}
+
+static int __writev_all(int fd, struct iovec *iov, size_t n){
+	while (n > 0){
+		int batch = n < IOV_BATCH ? n : IOV_BATCH;
+		ssize_t written = writev(fd, iov, batch);
+		if (written < 0){
+			if (errno == EINTR)
+				continue;
+			return -1;
+		}
+		while (n > 0 && (size_t)written >= iov->iov_len){
+			written -= iov->iov_len;
+			iov++;
+			n--;
+		}
+		if (written > 0){
+			iov->iov_base = (char*)iov->iov_base + written;
+			iov->iov_len -= written;
+		}
+	}
+	return 0;
+}
+
+/*
+ * iov[0] and iov[1] are reserved for the header and offsets.
+ * iov[2 + i] holds the i-th string, including its NULL terminator.
+ */
+static int __write_pack(int fd, struct iovec *iov, size_t n, uint32_t char_size){
+	unsigned char *offsets = malloc((n + 1) * sizeof(uint64_t));
+	if (!offsets)
+		return -2;
+	struct checksum ck = {0};
+	uint64_t off = 0;
+	for (size_t i = 0; i < n; i++){
+		__put_le64(&offsets[i * 8], off);
+		off += iov[2 + i].iov_len / char_size;
+	}
+	__put_le64(&offsets[n * 8], off);
+	__checksum_update(&ck, offsets, (n + 1) * sizeof(uint64_t));
+	for (size_t i = 0; i < n; i++)
+		__checksum_update(&ck, iov[2 + i].iov_base, iov[2 + i].iov_len);
+
+	unsigned char header[HEADER_SIZE];
+	memcpy(header, MAGIC, MAGIC_SIZE);
+	__put_le32(&header[8], char_size);
+	__put_le32(&header[12], HOST_ORDER);
+	__put_le64(&header[16], n);
+	__put_le64(&header[24], __checksum_final(&ck));
+
+	iov[0] = (struct iovec){ .iov_base = header, .iov_len = HEADER_SIZE };
+	iov[1] = (struct iovec){ .iov_base = offsets, .iov_len = (n + 1) * sizeof(uint64_t) };
+	int ret = __writev_all(fd, iov, n + 2) < 0 ? -2 : 1;
+	free(offsets);
+	return ret;
+}
+
+int str_pack_write(int fd, string_t **arr, size_t n){
+	if (!arr && n > 0)
+		return -1;
+	struct iovec *iov = malloc((n + 2) * sizeof(struct iovec));
+	if (!iov)
+		return -2;
+	for (size_t i = 0; i < n; i++){
+		/* The buffer is always NULL terminated */
+		const string_t *str = arr[i];
+		iov[2 + i].iov_base = str ? str->buffer : "";
+		iov[2 + i].iov_len = ((str ? str->length : 0) + 1) * sizeof(char);
+	}
+	int ret = __write_pack(fd, iov, n, sizeof(char));
+	free(iov);
+	return ret;
+}
+
+int wstr_pack_write(int fd, wstring_t **arr, size_t n){
+	if (!arr && n > 0)
+		return -1;
+	struct iovec *iov = malloc((n + 2) * sizeof(struct iovec));
+	if (!iov)
+		return -2;
+	/* Compact strings are widened into tmp, rather than into their
+	 * cached wide copy, which would stay around after the write */
+	size_t n_tmp = 0;
+	for (size_t i = 0; i < n; i++){
+		if (arr[i] && arr[i]->char_size != sizeof(wchar_t))
+			n_tmp += arr[i]->length + 1;
+	}
+	wchar_t *tmp = NULL;
+	if (n_tmp > 0 && !(tmp = malloc(n_tmp * sizeof(wchar_t)))){
+		free(iov);
+		return -2;
+	}
+	static const wchar_t empty[1] = { L'\0' };
+	wchar_t *next = tmp;
+	for (size_t i = 0; i < n; i++){
+		/* The buffer is always NULL terminated */
+		const wstring_t *wstr = arr[i];
+		const wchar_t *buf = empty;
+		if (wstr && wstr->char_size == sizeof(wchar_t)){
+			buf = wstr->buffer;
+		} else if (wstr){
+			for (size_t j = 0; j <= wstr->length; j++)
+				next[j] = __wstr_get(wstr, j);
+			buf = next;
+			next += wstr->length + 1;
+		}
+		iov[2 + i].iov_base = (wchar_t*)buf;
+		iov[2 + i].iov_len = ((wstr ? wstr->length : 0) + 1) * sizeof(wchar_t);
+	}
+	int ret = __write_pack(fd, iov, n, sizeof(wchar_t));
+	free(tmp);
+	free(iov);
+	return ret;
+}
+
+str_pack_t* str_pack_open(const char *path){
+	if (!path){
+		errno = EINVAL;
+		return NULL;
+	}
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	struct stat st;
+	if (fstat(fd, &st) < 0){
+		close(fd);
+		return NULL;
+	}
+	size_t size = st.st_size;
+	if (size < HEADER_SIZE + sizeof(uint64_t)){
+		close(fd);
+		errno = EINVAL;
+		return NULL;
+	}
+	const unsigned char *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return NULL;
+
+	uint32_t char_size = __get_le32(&map[8]);
+	uint32_t order = __get_le32(&map[12]);
+	uint64_t count = __get_le64(&map[16]);
+	size_t max_count = (size - HEADER_SIZE) / sizeof(uint64_t) - 1;
+	/* Wide data is stored as the host's wchar_t, so it can only be
+	 * read with the same byte order. Bytes don't have one. */
+	if (memcmp(map, MAGIC, MAGIC_SIZE) != 0
+	    || (char_size != sizeof(char) && char_size != sizeof(wchar_t))
+	    || (char_size != sizeof(char) && order != HOST_ORDER)
+	    || count > max_count)
+		goto invalid;
+
+	str_pack_t *pack = malloc(sizeof(*pack));
+	if (!pack){
+		munmap((void*)map, size);
+		return NULL;
+	}
+	pack->map = map;
+	pack->size = size;
+	pack->count = count;
+	pack->char_size = char_size;
+	pack->offsets = &map[HEADER_SIZE];
+	pack->data = &map[HEADER_SIZE + (count + 1) * sizeof(uint64_t)];
+	size_t data_size = size - (pack->data - map);
+	pack->data_chars = data_size / char_size;
+	if (data_size % char_size != 0
+	    || __get_le64(pack->offsets) != 0
+	    || __get_le64(&pack->offsets[count * 8]) != pack->data_chars){
+		free(pack);
+		goto invalid;
+	}
+	return pack;
+
+invalid:
+	munmap((void*)map, size);
+	errno = EINVAL;
+	return NULL;
+}
+
+int str_pack_verify(const str_pack_t *pack){
+	if (!pack)
+		return 0;
+	struct checksum ck = {0};
+	__checksum_update(&ck, pack->offsets, pack->size - HEADER_SIZE);
+	return __checksum_final(&ck) == __get_le64(&pack->map[24]);
+}
+
+int str_pack_is_wide(const str_pack_t *pack){
+	return pack && pack->char_size == sizeof(wchar_t);
+}
+
+size_t str_pack_count(const str_pack_t *pack){
+	if (!pack)
+		return 0;
+	return pack->count;
+}
+
+/*
+ * Gets the position of the index-th string, in chars.
+ * Corrupted offsets are caught here, so a damaged file can't make the
+ * views point outside the map.
+ */
+static int __get_range(const str_pack_t *pack, size_t index, uint32_t char_size,
+		       size_t *start, size_t *len){
+	if (!pack || pack->char_size != char_size || index >= pack->count)
+		return 0;
+	uint64_t s = __get_le64(&pack->offsets[index * 8]);
+	uint64_t e = __get_le64(&pack->offsets[(index + 1) * 8]);
+	if (s >= e || e > pack->data_chars)
+		return 0;
+	*start = s;
+	*len = e - s - 1;
+	return 1;
+}
+
+str_view_t str_pack_get(const str_pack_t *pack, size_t index){
+	size_t start, len;
+	if (!__get_range(pack, index, sizeof(char), &start, &len))
+		return (str_view_t){ .buf = NULL, .len = 0 };
+	const char *data = (const char*)pack->data;
+	if (data[start + len] != '\0')
+		return (str_view_t){ .buf = NULL, .len = 0 };
+	return (str_view_t){ .buf = &data[start], .len = len };
+}
+
+wstr_view_t wstr_pack_get(const str_pack_t *pack, size_t index){
+	size_t start, len;
+	if (!__get_range(pack, index, sizeof(wchar_t), &start, &len))
+		return (wstr_view_t){ .buf = NULL, .len = 0 };
+	const wchar_t *data = (const wchar_t*)pack->data;
+	if (data[start + len] != L'\0')
+		return (wstr_view_t){ .buf = NULL, .len = 0 };
+	return (wstr_view_t){ .buf = &data[start], .len = len };
+}
+
+void str_pack_close(str_pack_t *pack){
+	if (pack){
+		munmap((void*)pack->map, pack->size);
+		free(pack);
+	}
+}
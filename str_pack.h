@@ -0,0 +1,83 @@
+/*
+ * str_pack.h - str_pack_t definition.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Binary format to store arrays of string_t or wstring_t in a file, and
+ * load them back without any per-string allocation or copy. The file is
+ * mapped into memory and every string is accessed as a view.
+ *
+ * Layout (the header and offsets are little endian):
+ *   header   magic "STRPACK1", u32 char size, u32 byte order of the
+ *            data (0 little, 1 big endian), u64 number of strings,
+ *            u64 checksum
+ *   offsets  (count + 1) u64, start of each string in data
+ *   data     the strings, each one followed by a NULL terminator
+ * The checksum covers the offsets and the data.
+ * The data of wide packs is the host's wchar_t in its byte order, so
+ * they can only be opened where wchar_t has the same size and byte
+ * order. Packs of char are portable.
+ */
+#pragma once
+#ifndef STR_PACK_H
+#define STR_PACK_H
+
+#include "str.h"
+#include "wstr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct str_pack str_pack_t;
+
+/**
+ * Writes the n strings of arr to the file descriptor.
+ * NULL elements are written as empty strings.
+ * @return 1 on success, -1 if arr is NULL, -2 on a write error
+ */
+int str_pack_write(int fd, string_t **arr, size_t n);
+int wstr_pack_write(int fd, wstring_t **arr, size_t n);
+
+/**
+ * Maps the file at path into memory.
+ * Only the structure of the file is checked, see str_pack_verify.
+ * @return the str_pack_t, or NULL if the file can't be mapped
+ *         or is not a valid pack for this host (errno is EINVAL)
+ */
+str_pack_t* str_pack_open(const char *path);
+
+/**
+ * Checks the checksum of the whole file.
+ * @return 1 if it matches, 0 if not
+ */
+int str_pack_verify(const str_pack_t *pack);
+
+/**
+ * Returns 1 if the pack holds wstring_t, 0 if it holds string_t
+ */
+int str_pack_is_wide(const str_pack_t *pack);
+
+/**
+ * Returns the number of strings in the pack
+ */
+size_t str_pack_count(const str_pack_t *pack);
+
+/**
+ * Returns a view of the string at the given index.
+ * The view's buffer is NULL terminated and lives until str_pack_close.
+ * If the index is out of bounds or the pack doesn't hold strings of that
+ * type, returns an empty view with a NULL buffer.
+ */
+str_view_t str_pack_get(const str_pack_t *pack, size_t index);
+wstr_view_t wstr_pack_get(const str_pack_t *pack, size_t index);
+
+/**
+ * Unmaps the file and frees the str_pack_t
+ */
+void str_pack_close(str_pack_t *pack);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STR_PACK_H
@@ -0,0 +1,106 @@
+/*
+ * str_reader.c - str_reader_t implementation.
+ * Author: Saúl Valdelvira (2023)
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str_reader.h"
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h> // memchr, memcpy
+#include "internal.h"
+
+#define READER_BUFFER_SIZE (64 * 1024)
+
+struct str_reader {
+	int   fd;
+	FILE *file;
+	size_t start;
+	size_t end;
+	int eof;
+	char buffer[READER_BUFFER_SIZE];
+};
+
+static str_reader_t* __reader_init(int fd, FILE *file){
+	str_reader_t *reader = malloc(sizeof(*reader));
+	assert(reader);
+	reader->fd = fd;
+	reader->file = file;
+	reader->start = reader->end = 0;
+	reader->eof = 0;
+	return reader;
+}
+
+str_reader_t* str_reader_from_fd(int fd){
+	if (fd < 0)
+		return NULL;
+	return __reader_init(fd, NULL);
+}
+
+str_reader_t* str_reader_from_file(FILE *file){
+	if (!file)
+		return NULL;
+	return __reader_init(-1, file);
+}
+
+/*
+ * Refills the buffer
+ * @return the number of bytes read, 0 at EOF, -1 on error
+ */
+static long __fill(str_reader_t *reader){
+	reader->start = reader->end = 0;
+	if (reader->eof)
+		return 0;
+	long n = __read_some(reader->fd, reader->file, reader->buffer, READER_BUFFER_SIZE);
+	if (n < 0)
+		return -1;
+	if (n == 0)
+		reader->eof = 1;
+	reader->end = n;
+	return n;
+}
+
+static void __append(string_t *str, const char *src, size_t n){
+	__str_reserve(str, n);
+	memcpy(&str->buffer[str->length], src, n * sizeof(char));
+	str->length += n;
+	str->buffer[str->length] = '\0';
+}
+
+int str_read_until(str_reader_t *reader, char delim, string_t *out){
+	if (!reader || !out)
+		return -1;
+	str_clear(out);
+	int found_any = 0;
+	for (;;){
+		if (reader->start == reader->end){
+			long n = __fill(reader);
+			if (n < 0)
+				return -2;
+			if (n == 0)
+				return found_any;
+		}
+		found_any = 1;
+		const char *chunk = &reader->buffer[reader->start];
+		size_t avail = reader->end - reader->start;
+		const char *match = memchr(chunk, delim, avail);
+		if (match){
+			size_t len = match - chunk;
+			__append(out, chunk, len);
+			reader->start += len + 1;
+			return 1;
+		}
+		__append(out, chunk, avail);
+		reader->start = reader->end;
+	}
+}
+
+int str_read_line(str_reader_t *reader, string_t *out){
+	int ret = str_read_until(reader, '\n', out);
+	if (ret == 1 && out->length > 0 && out->buffer[out->length - 1] == '\r')
+		str_pop(out);
+	return ret;
+}
+
+void str_reader_free(str_reader_t *reader){
+	free(reader);
+}
@@ -0,0 +1,59 @@
+/*
+ * str_reader.h - str_reader_t definition.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * A str_reader_t reads delimited records from a file descriptor or
+ * a FILE* through a big internal buffer, storing each record in a
+ * string_t provided by the caller. Reusing the same string_t between
+ * calls avoids any allocation once it's big enough for the records.
+ */
+#pragma once
+#ifndef STR_READER_H
+#define STR_READER_H
+
+#include "str.h"
+#include <stdio.h> // FILE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct str_reader str_reader_t;
+
+/**
+ * Builds a str_reader_t that reads from the given file descriptor.
+ * @note The file descriptor is not closed by str_reader_free
+ */
+str_reader_t* str_reader_from_fd(int fd);
+
+/**
+ * Builds a str_reader_t that reads from the given FILE.
+ * @note The FILE is not closed by str_reader_free
+ */
+str_reader_t* str_reader_from_file(FILE *file);
+
+/**
+ * Reads the next record, up to the given delimiter, into out.
+ * out is cleared first (see str_clear), and the delimiter is not stored.
+ * The last record doesn't need to end with the delimiter.
+ * @return 1 if a record was read, 0 at the end of the input,
+ *         -1 if reader or out are NULL, -2 on a read error.
+ */
+int str_read_until(str_reader_t *reader, char delim, string_t *out);
+
+/**
+ * Same as str_read_until with '\n' as the delimiter.
+ * A '\r' right before the '\n' is also removed.
+ */
+int str_read_line(str_reader_t *reader, string_t *out);
+
+/**
+ * Frees the str_reader_t
+ */
+void str_reader_free(str_reader_t *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STR_READER_H
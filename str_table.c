@@ -0,0 +1,215 @@
+/*
+ * str_table.c - str_table_t implementation.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * The strings are stored one after the other in data, each followed
+ * by a '\0', and offsets[i] is the start of the i-th string. There's
+ * always an extra offset at the end, so the length of the i-th string
+ * is offsets[i + 1] - offsets[i] - 1.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str_table.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memcpy, memcmp, strnlen
+#include "util.h"
+#include "internal.h"
+
+#define INITIAL_COUNT 16
+#define INITIAL_CHARS 256
+#ifndef GROW_FACTOR
+#define GROW_FACTOR 2
+#endif
+
+struct str_table {
+	char   *data;
+	size_t  data_length;
+	size_t  data_size;
+	size_t *offsets;
+	size_t  count;
+	size_t  offsets_size;
+	int     frozen;
+};
+
+static void __resize_data(str_table_t *table, size_t new_size){
+	if (new_size == 0)
+		new_size = 1;
+	table->data_size = new_size;
+	table->data = realloc(table->data, table->data_size * sizeof(char));
+	assert(table->data);
+}
+
+static void __resize_offsets(str_table_t *table, size_t new_size){
+	table->offsets_size = new_size;
+	table->offsets = realloc(table->offsets, (table->offsets_size + 1) * sizeof(size_t));
+	assert(table->offsets);
+}
+
+str_table_t* str_table_init(unsigned n, size_t n_chars){
+	str_table_t *table = malloc(sizeof(*table));
+	assert(table);
+	table->data = NULL;
+	table->offsets = NULL;
+	table->data_length = 0;
+	table->count = 0;
+	table->frozen = 0;
+	__resize_data(table, n_chars + n);
+	__resize_offsets(table, n);
+	table->offsets[0] = 0;
+	return table;
+}
+
+str_table_t* str_table_empty(void){
+	return str_table_init(INITIAL_COUNT, INITIAL_CHARS);
+}
+
+void str_table_reserve(str_table_t *table, size_t n, size_t n_chars){
+	if (!table || table->frozen)
+		return;
+	if (table->offsets_size < n)
+		__resize_offsets(table, n);
+	if (table->data_size < n_chars + n)
+		__resize_data(table, n_chars + n);
+}
+
+static INLINE void __grow_for(str_table_t *table, size_t n, size_t n_chars){
+	if (table->count + n > table->offsets_size){
+		size_t new_size = table->offsets_size * GROW_FACTOR;
+		if (table->count + n > new_size)
+			new_size += n;
+		__resize_offsets(table, new_size);
+	}
+	size_t needed = n_chars + n;
+	if (table->data_size - table->data_length < needed){
+		size_t new_size = table->data_size * GROW_FACTOR;
+		if (new_size - table->data_length < needed)
+			new_size += needed;
+		__resize_data(table, new_size);
+	}
+}
+
+/* The space must be already reserved */
+static INLINE void __push(str_table_t *table, const char *src, size_t len){
+	char *dst = &table->data[table->data_length];
+	if (len > 0)
+		memcpy(dst, src, len * sizeof(char));
+	dst[len] = '\0';
+	table->data_length += len + 1;
+	table->offsets[++table->count] = table->data_length;
+}
+
+int str_table_push_view(str_table_t *table, str_view_t view){
+	if (!table || (!view.buf && view.len > 0))
+		return -1;
+	if (table->frozen)
+		return -2;
+	/* view may point into data (e.g. a string of this same table),
+	 * which __grow_for can move */
+	uintptr_t off = (uintptr_t)view.buf - (uintptr_t)table->data;
+	int aliased = view.buf && off < table->data_size;
+	__grow_for(table, 1, view.len);
+	if (aliased)
+		view.buf = table->data + off;
+	__push(table, view.buf, view.len);
+	return 1;
+}
+
+int str_table_push_cstr(str_table_t *table, const char *cstr, unsigned n){
+	if (!cstr)
+		return -1;
+	return str_table_push_view(table, (str_view_t){ .buf = cstr, .len = strnlen(cstr, n) });
+}
+
+int str_table_push_str(str_table_t *table, const string_t *str){
+	if (!str)
+		return -1;
+	return str_table_push_view(table, str_as_view(str));
+}
+
+int str_table_push_all(str_table_t *table, string_t **arr, size_t n){
+	if (!table || !arr)
+		return -1;
+	if (table->frozen)
+		return -2;
+	size_t n_chars = 0;
+	for (size_t i = 0; i < n; i++)
+		n_chars += arr[i] ? arr[i]->length : 0;
+	__grow_for(table, n, n_chars);
+	for (size_t i = 0; i < n; i++){
+		if (arr[i])
+			__push(table, arr[i]->buffer, arr[i]->length);
+		else
+			__push(table, "", 0);
+	}
+	return 1;
+}
+
+int str_table_push_all_cstr(str_table_t *table, const char **arr, size_t n){
+	if (!table || !arr)
+		return -1;
+	if (table->frozen)
+		return -2;
+	size_t *lens = malloc(n * sizeof(size_t));
+	assert(lens || n == 0);
+	size_t n_chars = 0;
+	for (size_t i = 0; i < n; i++){
+		lens[i] = arr[i] ? strlen(arr[i]) : 0;
+		n_chars += lens[i];
+	}
+	__grow_for(table, n, n_chars);
+	for (size_t i = 0; i < n; i++)
+		__push(table, arr[i] ? arr[i] : "", lens[i]);
+	free(lens);
+	return 1;
+}
+
+size_t str_table_count(const str_table_t *table){
+	if (!table)
+		return 0;
+	return table->count;
+}
+
+str_view_t str_table_get(const str_table_t *table, size_t index){
+	if (!table || index >= table->count)
+		return (str_view_t){ .buf = NULL, .len = 0 };
+	size_t start = table->offsets[index];
+	return (str_view_t){
+		.buf = &table->data[start],
+		.len = table->offsets[index + 1] - start - 1
+	};
+}
+
+long str_table_find(const str_table_t *table, str_view_t view, size_t start_at){
+	if (!table || (!view.buf && view.len > 0))
+		return -1;
+	/* Only the offsets are scanned until a string of the same length shows up */
+	size_t stride = view.len + 1;
+	for (size_t i = start_at; i < table->count; i++){
+		size_t start = table->offsets[i];
+		if (table->offsets[i + 1] - start == stride &&
+		    memcmp(&table->data[start], view.buf, view.len * sizeof(char)) == 0)
+			return i;
+	}
+	return -1;
+}
+
+void str_table_freeze(str_table_t *table){
+	if (!table || table->frozen)
+		return;
+	__resize_data(table, table->data_length);
+	__resize_offsets(table, table->count);
+	table->frozen = 1;
+}
+
+int str_table_is_frozen(const str_table_t *table){
+	return table && table->frozen;
+}
+
+void str_table_free(str_table_t *table){
+	if (table){
+		free(table->data);
+		free(table->offsets);
+		free(table);
+	}
+}
@@ -0,0 +1,95 @@
+/*
+ * str_table.h - str_table_t definition.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * A str_table_t stores many strings in a single contiguous buffer, with
+ * an array of offsets to access each one in O(1). Compared to an array of
+ * string_t, there's no per-string header or allocation, and iterating over
+ * the strings walks memory sequentially.
+ */
+#pragma once
+#ifndef STR_TABLE_H
+#define STR_TABLE_H
+
+#include "str.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct str_table str_table_t;
+
+/**
+ * Builds an empty str_table_t
+ */
+str_table_t* str_table_empty(void);
+
+/**
+ * Builds a str_table_t with space for n strings and n_chars chars in total
+ */
+str_table_t* str_table_init(unsigned n, size_t n_chars);
+
+/**
+ * Reserves space for n strings and n_chars chars in total
+ */
+void str_table_reserve(str_table_t *table, size_t n, size_t n_chars);
+
+/**
+ * Appends a copy of the given string at the end of the table.
+ * @param n max length of cstr
+ * @return 1 on success, -1 if an argument is NULL, -2 if the table is frozen
+ */
+int str_table_push_cstr(str_table_t *table, const char *cstr, unsigned n);
+int str_table_push_str(str_table_t *table, const string_t *str);
+int str_table_push_view(str_table_t *table, str_view_t view);
+
+/**
+ * Appends copies of n strings at once. The space for all of them
+ * is reserved up front.
+ * @return 1 on success, -1 if an argument is NULL, -2 if the table is frozen
+ */
+int str_table_push_all(str_table_t *table, string_t **arr, size_t n);
+int str_table_push_all_cstr(str_table_t *table, const char **arr, size_t n);
+
+/**
+ * Returns the number of strings in the table
+ */
+size_t str_table_count(const str_table_t *table);
+
+/**
+ * Returns a view of the string at the given index.
+ * The view's buffer is NULL terminated.
+ * If the index is out of bounds, returns an empty view with a NULL buffer.
+ * @note The view is invalidated by pushing to the table, unless it's frozen
+ */
+str_view_t str_table_get(const str_table_t *table, size_t index);
+
+/**
+ * Finds the first string equal to view, starting at index [start_at]
+ * @return Index of the string, or -1 if there isn't any
+ */
+long str_table_find(const str_table_t *table, str_view_t view, size_t start_at);
+
+/**
+ * Shrinks the table to fit its content and makes it read-only.
+ * A frozen table can't be modified, so the views returned by
+ * str_table_get stay valid until it's freed, and it's safe to read
+ * from multiple threads.
+ */
+void str_table_freeze(str_table_t *table);
+
+/**
+ * Returns 1 if the table is frozen, 0 if not
+ */
+int str_table_is_frozen(const str_table_t *table);
+
+/**
+ * Frees all the memory allocated for the table
+ */
+void str_table_free(str_table_t *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STR_TABLE_H
@@ -0,0 +1,612 @@
+/*
+ * unicode.c - Unicode case folding and normalization (NFC and NFD).
+ * Author: Saúl Valdelvira (2023)
+ *
+ * The character properties come from the two stage tables of
+ * unicode_data.h, so nothing here depends on the locale.
+ * Normalization works on segments: a starter and the characters that
+ * can reorder or combine with it. Each character is decomposed into the
+ * segment, and when a starter that can't combine with what's before it
+ * comes, the segment is put in canonical order, composed (for NFC) and
+ * written out. ASCII characters are starters that never decompose or
+ * combine with a previous character, so runs of them are copied as is.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str.h"
+#include "wstr.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memcpy
+#include "util.h"
+#include "internal.h"
+#include "unicode_data.h"
+
+#define UNI_MASK ((1 << UNI_SHIFT) - 1)
+#define __lookup(table, c) \
+	__uni_##table##_stage2[__uni_##table##_stage1[(c) >> UNI_SHIFT] << UNI_SHIFT | ((c) & UNI_MASK)]
+
+/* Hangul syllables, see section 3.12 of the Unicode standard */
+#define S_BASE  0xAC00
+#define L_BASE  0x1100
+#define V_BASE  0x1161
+#define T_BASE  0x11A7
+#define L_COUNT 19
+#define V_COUNT 21
+#define T_COUNT 28
+#define N_COUNT (V_COUNT * T_COUNT)
+#define S_COUNT (L_COUNT * N_COUNT)
+
+#define ASCII_MASK 0x8080808080808080ULL
+#define SEGMENT_SIZE 32
+
+static INLINE const struct uni_props* __props(uint32_t c){
+	static const struct uni_props none = { 0, 0 };
+	if (c >= UNI_LIMIT)
+		return &none;
+	return &__uni_props[__lookup(props, c)];
+}
+
+static INLINE unsigned __ccc(uint32_t c){
+	return __props(c)->ccc;
+}
+
+static INLINE const uint32_t* __mapping(uint16_t v, size_t *len){
+	*len = v & 7;
+	return &__uni_data[v >> 3];
+}
+
+/*
+ * Decodes a UTF-8 sequence, rejecting overlong forms, surrogates and
+ * code points above U+10FFFF.
+ * @return the length of the sequence, or 0 if it's not valid
+ */
+static INLINE unsigned __utf8_decode(const unsigned char *p, size_t avail, uint32_t *cp){
+	unsigned len;
+	uint32_t c, min;
+	if (p[0] < 0x80){
+		*cp = p[0];
+		return 1;
+	} else if ((p[0] & 0xE0) == 0xC0){
+		len = 2;
+		c = p[0] & 0x1F;
+		min = 0x80;
+	} else if ((p[0] & 0xF0) == 0xE0){
+		len = 3;
+		c = p[0] & 0x0F;
+		min = 0x800;
+	} else if ((p[0] & 0xF8) == 0xF0){
+		len = 4;
+		c = p[0] & 0x07;
+		min = 0x10000;
+	} else {
+		return 0;
+	}
+	if (len > avail)
+		return 0;
+	for (unsigned j = 1; j < len; j++){
+		if ((p[j] & 0xC0) != 0x80)
+			return 0;
+		c = c << 6 | (p[j] & 0x3F);
+	}
+	if (c < min || c > 0x10FFFF || (c >= 0xD800 && c < 0xE000))
+		return 0;
+	*cp = c;
+	return len;
+}
+
+/*
+ * Lowercases n ASCII chars, 8 at a time. Since the high bit of every
+ * byte is clear, adding to a byte never carries into the next one.
+ */
+static void __ascii_lower(char *p, size_t n){
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8){
+		uint64_t w;
+		memcpy(&w, &p[i], 8);
+		uint64_t ge_a = w + 0x3F3F3F3F3F3F3F3FULL; // bit 7 set if >= 'A'
+		uint64_t gt_z = w + 0x2525252525252525ULL; // bit 7 set if > 'Z'
+		w |= (ge_a & ~gt_z & ASCII_MASK) >> 2;
+		memcpy(&p[i], &w, 8);
+	}
+	for (; i < n; i++){
+		if (p[i] >= 'A' && p[i] <= 'Z')
+			p[i] |= 0x20;
+	}
+}
+
+/* Length of the run of ASCII chars at the start of p */
+static size_t __ascii_span(const char *p, size_t n){
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8){
+		uint64_t w;
+		memcpy(&w, &p[i], 8);
+		if (w & ASCII_MASK)
+			break;
+	}
+	while (i < n && (unsigned char)p[i] < 0x80)
+		i++;
+	return i;
+}
+
+/*
+ * Input, either UTF-8 (char_size 0) or the buffer of a wstring_t.
+ * The functions that take one are inlined with a constant char_size.
+ */
+struct source {
+	const void *buf;
+	size_t len;
+	size_t pos;
+	unsigned char_size;
+};
+
+static INLINE uint32_t __src_get(const struct source *src, size_t i){
+	switch (src->char_size){
+	case 0:
+	case 1:  return ((const uint8_t*)src->buf)[i];
+	case 2:  return ((const uint16_t*)src->buf)[i];
+	default: return ((const wchar_t*)src->buf)[i];
+	}
+}
+
+/* @return 1 on success, 0 if the input is not valid UTF-8 */
+static INLINE int __src_next(struct source *src, uint32_t *c){
+	if (src->char_size != 0){
+		*c = __src_get(src, src->pos++);
+		return 1;
+	}
+	unsigned len = __utf8_decode((const unsigned char*)src->buf + src->pos, src->len - src->pos, c);
+	src->pos += len;
+	return len != 0;
+}
+
+static INLINE size_t __src_ascii_span(const struct source *src){
+	if (src->char_size <= 1)
+		return __ascii_span((const char*)src->buf + src->pos, src->len - src->pos);
+	size_t i = src->pos;
+	while (i < src->len && __src_get(src, i) < 0x80)
+		i++;
+	return i - src->pos;
+}
+
+/* Output, either UTF-8 or wchar_t */
+struct sink {
+	int utf8;
+	void *buf;
+	size_t len;
+	size_t cap;
+};
+
+static void __sink_init(struct sink *dst, int utf8, size_t cap){
+	dst->utf8 = utf8;
+	dst->len = 0;
+	dst->cap = cap + 1;
+	dst->buf = malloc(dst->cap * (utf8 ? sizeof(char) : sizeof(wchar_t)));
+	assert(dst->buf);
+}
+
+/* Makes room for n more chars, and the '\0' after them */
+static INLINE void __sink_reserve(struct sink *dst, size_t n){
+	if (dst->len + n < dst->cap)
+		return;
+	size_t new_cap = dst->cap * 2;
+	if (dst->len + n >= new_cap)
+		new_cap = dst->len + n + 1;
+	dst->cap = new_cap;
+	dst->buf = realloc(dst->buf, dst->cap * (dst->utf8 ? sizeof(char) : sizeof(wchar_t)));
+	assert(dst->buf);
+}
+
+static INLINE void __emit(struct sink *dst, uint32_t c){
+	if (dst->utf8){
+		__sink_reserve(dst, 4);
+		char *p = (char*)dst->buf + dst->len;
+		dst->len = __put_utf8(p, c) - (char*)dst->buf;
+	} else {
+		__sink_reserve(dst, 1);
+		((wchar_t*)dst->buf)[dst->len++] = c;
+	}
+}
+
+/* Copies the next n chars of src, that are all ASCII */
+static INLINE void __emit_ascii(struct sink *dst, struct source *src, size_t n, int lower){
+	__sink_reserve(dst, n);
+	if (dst->utf8){
+		char *p = (char*)dst->buf + dst->len;
+		memcpy(p, (const char*)src->buf + src->pos, n);
+		if (lower)
+			__ascii_lower(p, n);
+	} else {
+		wchar_t *p = (wchar_t*)dst->buf + dst->len;
+		for (size_t i = 0; i < n; i++){
+			wchar_t c = __src_get(src, src->pos + i);
+			p[i] = lower && c >= 'A' && c <= 'Z' ? c | 0x20 : c;
+		}
+	}
+	dst->len += n;
+	src->pos += n;
+}
+
+/* @return 1 on success, -2 if the input is not valid UTF-8 */
+static INLINE int __casefold(struct source *src, struct sink *dst){
+	while (src->pos < src->len){
+		size_t n = __src_ascii_span(src);
+		if (n > 0){
+			__emit_ascii(dst, src, n, 1);
+			continue;
+		}
+		uint32_t c;
+		if (!__src_next(src, &c))
+			return -2;
+		uint16_t v = c < UNI_LIMIT ? __lookup(fold, c) : 0;
+		if (v == 0){
+			__emit(dst, c);
+			continue;
+		}
+		size_t len;
+		const uint32_t *folded = __mapping(v, &len);
+		for (size_t i = 0; i < len; i++)
+			__emit(dst, folded[i]);
+	}
+	return 1;
+}
+
+struct segment {
+	uint32_t *chars;
+	size_t len;
+	size_t cap;
+	int composed; // chars[0] is a starter left composed, see __decompose_into
+	uint32_t small[SEGMENT_SIZE];
+};
+
+static INLINE void __segment_push(struct segment *seg, uint32_t c){
+	if (seg->len == seg->cap){
+		seg->cap *= 2;
+		if (seg->chars == seg->small){
+			seg->chars = malloc(seg->cap * sizeof(uint32_t));
+			assert(seg->chars);
+			memcpy(seg->chars, seg->small, sizeof(seg->small));
+		} else {
+			seg->chars = realloc(seg->chars, seg->cap * sizeof(uint32_t));
+			assert(seg->chars);
+		}
+	}
+	seg->chars[seg->len++] = c;
+}
+
+/*
+ * Finds the primary composite of a and b.
+ * @return the composite, or 0 if there isn't any
+ */
+static uint32_t __compose(uint32_t a, uint32_t b){
+	if (a - L_BASE < L_COUNT && b - V_BASE < V_COUNT)
+		return S_BASE + ((a - L_BASE) * V_COUNT + (b - V_BASE)) * T_COUNT;
+	if (a - S_BASE < S_COUNT && (a - S_BASE) % T_COUNT == 0 && b - T_BASE - 1 < T_COUNT - 1)
+		return a + (b - T_BASE);
+	if (!(__props(b)->flags & UNI_SECOND))
+		return 0;
+	size_t lo = 0, hi = sizeof(__uni_comp) / sizeof(__uni_comp[0]);
+	while (lo < hi){
+		size_t mid = lo + (hi - lo) / 2;
+		const uint32_t *p = __uni_comp[mid];
+		if (p[0] < a || (p[0] == a && p[1] < b))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < sizeof(__uni_comp) / sizeof(__uni_comp[0])
+	    && __uni_comp[lo][0] == a && __uni_comp[lo][1] == b)
+		return __uni_comp[lo][2];
+	return 0;
+}
+
+/* Sorts the non starters of the segment by their combining class */
+static void __reorder(struct segment *seg){
+	for (size_t i = 1; i < seg->len; i++){
+		uint32_t c = seg->chars[i];
+		unsigned ccc = __ccc(c);
+		if (ccc == 0)
+			continue;
+		size_t j = i;
+		while (j > 0 && __ccc(seg->chars[j - 1]) > ccc){
+			seg->chars[j] = seg->chars[j - 1];
+			j--;
+		}
+		seg->chars[j] = c;
+	}
+}
+
+/*
+ * Canonical composition of the segment. A character combines with the
+ * last starter if no character in between has a combining class equal
+ * or higher than its own.
+ */
+static void __compose_segment(struct segment *seg){
+	if (seg->len == 0)
+		return;
+	uint32_t *s = seg->chars;
+	size_t starter = 0, out = 1;
+	unsigned last = __ccc(s[0]) == 0 ? 0 : 256;
+	for (size_t i = 1; i < seg->len; i++){
+		uint32_t c = s[i];
+		unsigned ccc = __ccc(c);
+		if (last < ccc || last == 0){
+			uint32_t composite = __compose(s[starter], c);
+			if (composite){
+				s[starter] = composite;
+				continue;
+			}
+		}
+		if (ccc == 0)
+			starter = out;
+		last = ccc;
+		s[out++] = c;
+	}
+	seg->len = out;
+}
+
+static void __flush(struct segment *seg, struct sink *dst, int compose){
+	if (seg->len == 0)
+		return;
+	if (seg->len > 1){
+		__reorder(seg);
+		if (compose)
+			__compose_segment(seg);
+	}
+	for (size_t i = 0; i < seg->len; i++)
+		__emit(dst, seg->chars[i]);
+	seg->len = 0;
+	seg->composed = 0;
+}
+
+/*
+ * Full canonical decomposition of c.
+ * @param hangul room for the decomposition of a Hangul syllable
+ */
+static INLINE const uint32_t* __decompose(uint32_t c, uint32_t *hangul, size_t *len){
+	if (c - S_BASE < S_COUNT){
+		uint32_t s = c - S_BASE;
+		hangul[0] = L_BASE + s / N_COUNT;
+		hangul[1] = V_BASE + s % N_COUNT / T_COUNT;
+		hangul[2] = T_BASE + s % T_COUNT;
+		*len = s % T_COUNT == 0 ? 2 : 3;
+		return hangul;
+	}
+	if (c < UNI_LIMIT){
+		uint16_t v = __lookup(decomp, c);
+		if (v != 0)
+			return __mapping(v, len);
+	}
+	hangul[0] = c;
+	*len = 1;
+	return hangul;
+}
+
+/* Decomposes the starter that was left composed at the segment's start */
+static void __expand_head(struct segment *seg){
+	uint32_t buf[3];
+	size_t len;
+	const uint32_t *chars = __decompose(seg->chars[0], buf, &len);
+	/* The segment has room for SEGMENT_SIZE chars at least */
+	memcpy(seg->chars, chars, len * sizeof(uint32_t));
+	seg->len = len;
+	seg->composed = 0;
+}
+
+/*
+ * Adds c to the segment, decomposed, flushing it first if c starts a
+ * new one. For NFC, a starter that NFC leaves as is doesn't need to be
+ * decomposed and composed back, unless something that comes after it
+ * can combine or reorder with its decomposition, so that's delayed.
+ */
+static INLINE void __decompose_into(struct segment *seg, struct sink *dst, uint32_t c, int compose){
+	const struct uni_props *p = __props(c);
+	if (compose && p->ccc == 0 && !(p->flags & (UNI_SECOND | UNI_NFC_NO))){
+		__flush(seg, dst, compose);
+		__segment_push(seg, c);
+		seg->composed = 1;
+		return;
+	}
+	uint32_t buf[3];
+	size_t len;
+	const uint32_t *chars = __decompose(c, buf, &len);
+	for (size_t i = 0; i < len; i++){
+		p = __props(chars[i]);
+		if (p->ccc == 0 && !(compose && (p->flags & UNI_SECOND)))
+			__flush(seg, dst, compose);
+		else if (seg->composed)
+			__expand_head(seg);
+		__segment_push(seg, chars[i]);
+	}
+}
+
+/* @return 1 on success, -2 if the input is not valid UTF-8 */
+static INLINE int __normalize(struct source *src, struct sink *dst, int compose){
+	struct segment seg;
+	seg.chars = seg.small;
+	seg.len = 0;
+	seg.cap = SEGMENT_SIZE;
+	seg.composed = 0;
+	int ret = 1;
+	while (src->pos < src->len){
+		size_t n = __src_ascii_span(src);
+		if (n > 0){
+			__flush(&seg, dst, compose);
+			/* The last one could combine with what comes after it */
+			if (compose)
+				n--;
+			if (n > 0){
+				__emit_ascii(dst, src, n, 0);
+				continue;
+			}
+		}
+		uint32_t c;
+		if (!__src_next(src, &c)){
+			ret = -2;
+			break;
+		}
+		__decompose_into(&seg, dst, c, compose);
+	}
+	__flush(&seg, dst, compose);
+	if (seg.chars != seg.small)
+		free(seg.chars);
+	return ret;
+}
+
+#define CASEFOLD 0
+#define NFC 1
+#define NFD 2
+
+static int __str_apply(string_t *str, int op){
+	if (!str)
+		return -1;
+	size_t ascii = __ascii_span(str->buffer, str->length);
+	if (ascii == str->length){
+		if (op == CASEFOLD){
+			__ascii_lower(str->buffer, str->length);
+			__str_modified(str, 0);
+		}
+		return 1;
+	}
+	struct source src = { .buf = str->buffer, .len = str->length, .pos = 0, .char_size = 0 };
+	struct sink dst;
+	__sink_init(&dst, 1, str->length + str->length / 4);
+	int ret = op == CASEFOLD ? __casefold(&src, &dst) : __normalize(&src, &dst, op == NFC);
+	if (ret < 0){
+		free(dst.buf);
+		return ret;
+	}
+	((char*)dst.buf)[dst.len] = '\0';
+	free(str->buffer);
+	str->buffer = dst.buf;
+	str->length = dst.len;
+	str->buffer_size = dst.cap - 1;
+	__str_modified(str, 0);
+	return 1;
+}
+
+int str_casefold(string_t *str){
+	return __str_apply(str, CASEFOLD);
+}
+
+int str_normalize_nfc(string_t *str){
+	return __str_apply(str, NFC);
+}
+
+int str_normalize_nfd(string_t *str){
+	return __str_apply(str, NFD);
+}
+
+static INLINE unsigned __char_size_of(uint32_t c){
+	if (c < 0x100)
+		return 1;
+	return c < 0x10000 ? 2 : sizeof(wchar_t);
+}
+
+/* Replaces the contents of wstr with the output of dst */
+static void __wstr_assign(wstring_t *wstr, struct sink *dst){
+	wchar_t *src = dst->buf;
+	size_t n = dst->len;
+	size_t buffer_size = n;
+	unsigned char_size = sizeof(wchar_t);
+	if (wstr->compact){
+		/* Compact strings only get wider, like in wstr_transform */
+		uint32_t bits = 0;
+		for (size_t i = 0; i < n; i++)
+			bits |= (uint32_t)src[i];
+		char_size = __char_size_of(bits);
+		if (char_size < wstr->char_size)
+			char_size = wstr->char_size;
+	}
+	free(wstr->buffer);
+	if (char_size == sizeof(wchar_t)){
+		wstr->buffer = src;
+		buffer_size = dst->cap - 1;
+	} else {
+		wstr->buffer = malloc((n + 1) * char_size);
+		assert(wstr->buffer);
+		for (size_t i = 0; i <= n; i++){
+			if (char_size == 1)
+				((uint8_t*)wstr->buffer)[i] = src[i];
+			else
+				((uint16_t*)wstr->buffer)[i] = src[i];
+		}
+		free(src);
+	}
+	wstr->char_size = char_size;
+	wstr->length = n;
+	wstr->buffer_size = buffer_size;
+	__wstr_modified(wstr);
+}
+
+static void __wstr_ascii_lower(wstring_t *wstr){
+	switch (wstr->char_size){
+	case 1:
+		__ascii_lower(wstr->buffer, wstr->length);
+		break;
+	case 2:
+		for (size_t i = 0; i < wstr->length; i++){
+			uint16_t *p = &((uint16_t*)wstr->buffer)[i];
+			if (*p >= 'A' && *p <= 'Z')
+				*p |= 0x20;
+		}
+		break;
+	default:
+		for (size_t i = 0; i < wstr->length; i++){
+			wchar_t *p = &((wchar_t*)wstr->buffer)[i];
+			if (*p >= 'A' && *p <= 'Z')
+				*p |= 0x20;
+		}
+		break;
+	}
+	__wstr_modified(wstr);
+}
+
+static INLINE int __wstr_run(struct source *src, struct sink *dst, int op){
+	return op == CASEFOLD ? __casefold(src, dst) : __normalize(src, dst, op == NFC);
+}
+
+static int __wstr_apply(wstring_t *wstr, int op){
+	if (!wstr)
+		return -1;
+	/* Latin-1 has no combining marks, and it's all in NFC */
+	if (op == NFC && wstr->char_size == 1)
+		return 1;
+	struct source src = { .buf = wstr->buffer, .len = wstr->length, .pos = 0, .char_size = wstr->char_size };
+	if (__src_ascii_span(&src) == wstr->length){
+		if (op == CASEFOLD)
+			__wstr_ascii_lower(wstr);
+		return 1;
+	}
+	struct sink dst;
+	__sink_init(&dst, 0, wstr->length + wstr->length / 4);
+	switch (wstr->char_size){
+	case 1:
+		src.char_size = 1;
+		__wstr_run(&src, &dst, op);
+		break;
+	case 2:
+		src.char_size = 2;
+		__wstr_run(&src, &dst, op);
+		break;
+	default:
+		src.char_size = sizeof(wchar_t);
+		__wstr_run(&src, &dst, op);
+		break;
+	}
+	((wchar_t*)dst.buf)[dst.len] = L'\0';
+	__wstr_assign(wstr, &dst);
+	return 1;
+}
+
+int wstr_casefold(wstring_t *wstr){
+	return __wstr_apply(wstr, CASEFOLD);
+}
+
+int wstr_normalize_nfc(wstring_t *wstr){
+	return __wstr_apply(wstr, NFC);
+}
+
+int wstr_normalize_nfd(wstring_t *wstr){
+	return __wstr_apply(wstr, NFD);
+}
@@ -0,0 +1,2713 @@
+/*
+ * unicode_data.h - Unicode 14.0.0 tables used by unicode.c.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Generated by gen_unicode_data.py, don't edit by hand.
+ *
+ * Each property is a two stage table: stage1[c >> UNI_SHIFT] is the
+ * block of c, and its value is stage2[block << UNI_SHIFT | (c & mask)].
+ * Code points from UNI_LIMIT onwards have no properties.
+ * The decomposition and folding values are the offset of a sequence in
+ * __uni_data << 3 | its length, or 0 if the code point maps to itself.
+ * Decompositions are fully expanded, and Hangul syllables are left to
+ * the algorithm.
+ */
+#ifndef __STR_UNICODE_DATA_H
+#define __STR_UNICODE_DATA_H
+
+#include <stdint.h>
+
+#define UNI_SHIFT 6
+#define UNI_LIMIT 0x2FA40
+
+/* Can combine with a previous starter */
+#define UNI_SECOND 1
+/* Changes when put in NFC on its own */
+#define UNI_NFC_NO 2
+
+struct uni_props {
+	uint8_t ccc;
+	uint8_t flags;
+};
+
+static const struct uni_props __uni_props[66] = {
+	{ 0, 0 }, { 230, 1 }, { 230, 0 }, { 232, 0 }, { 220, 0 }, { 216, 1 }, { 202, 0 }, { 220, 1 },
+	{ 202, 1 }, { 1, 0 }, { 1, 1 }, { 230, 2 }, { 240, 1 }, { 233, 0 }, { 234, 0 }, { 0, 2 },
+	{ 222, 0 }, { 228, 0 }, { 10, 0 }, { 11, 0 }, { 12, 0 }, { 13, 0 }, { 14, 0 }, { 15, 0 },
+	{ 16, 0 }, { 17, 0 }, { 18, 0 }, { 19, 0 }, { 20, 0 }, { 21, 0 }, { 22, 0 }, { 23, 0 },
+	{ 24, 0 }, { 25, 0 }, { 30, 0 }, { 31, 0 }, { 32, 0 }, { 27, 0 }, { 28, 0 }, { 29, 0 },
+	{ 33, 0 }, { 34, 0 }, { 35, 0 }, { 36, 0 }, { 7, 1 }, { 9, 0 }, { 7, 0 }, { 0, 1 },
+	{ 84, 0 }, { 91, 1 }, { 9, 1 }, { 103, 0 }, { 107, 0 }, { 118, 0 }, { 122, 0 }, { 216, 0 },
+	{ 129, 0 }, { 130, 0 }, { 132, 0 }, { 214, 0 }, { 218, 0 }, { 224, 0 }, { 8, 1 }, { 26, 0 },
+	{ 6, 0 }, { 226, 0 },
+};
+
+static const uint8_t __uni_props_stage1[3049] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0,
+	0, 0, 4, 0, 0, 0, 5, 6, 7, 8, 0, 9, 10, 11, 0, 12,
+	13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 19, 25, 26, 27,
+	23, 28, 23, 29, 30, 27, 0, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+	40, 0, 41, 0, 0, 42, 43, 44, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 47,
+	0, 0, 48, 0, 49, 0, 0, 0, 50, 51, 52, 53, 54, 55, 56, 57,
+	58, 0, 0, 59, 0, 0, 0, 60, 0, 0, 0, 0, 0, 61, 62, 63,
+	64, 0, 0, 65, 66, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0,
+	0, 0, 0, 69, 0, 70, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0,
+	72, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 75, 76, 0, 0, 0, 0,
+	77, 0, 0, 78, 79, 80, 81, 82, 0, 0, 83, 84, 0, 0, 0, 85,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 86, 86, 86, 86, 87, 88, 86, 89, 90, 91, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 94, 0, 95, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0, 97, 0, 0, 0, 0,
+	0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 99, 0, 0, 100, 101, 0,
+	0, 102, 103, 0, 104, 81, 0, 105, 106, 0, 0, 107, 108, 109, 0, 0,
+	0, 110, 111, 112, 0, 0, 113, 114, 70, 0, 115, 0, 116, 0, 0, 0,
+	117, 0, 0, 0, 118, 119, 0, 120, 121, 122, 123, 0, 0, 0, 0, 0,
+	70, 0, 0, 0, 0, 124, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 127, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 130, 131, 132, 0, 133, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	134, 0, 0, 0, 127, 0, 0, 0, 0, 0, 135, 136, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 137, 0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	86, 86, 86, 86, 86, 86, 86, 86, 139,
+};
+
+static const uint8_t __uni_props_stage2[8960] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1,
+	2, 1, 2, 1, 1, 3, 4, 4, 4, 4, 3, 5, 4, 4, 4, 4,
+	4, 6, 6, 7, 7, 7, 7, 8, 8, 4, 4, 4, 4, 7, 7, 4,
+	7, 7, 4, 4, 9, 9, 9, 9, 10, 4, 4, 4, 4, 2, 2, 2,
+	11, 11, 1, 11, 11, 12, 2, 4, 4, 4, 2, 2, 2, 4, 4, 0,
+	2, 2, 2, 4, 4, 4, 4, 2, 3, 4, 4, 2, 13, 14, 14, 13,
+	14, 14, 13, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0,
+	0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4, 2, 2, 2, 2, 4, 2, 2, 2, 16, 4, 2, 2, 2, 2,
+	2, 2, 4, 4, 4, 4, 4, 4, 2, 2, 4, 2, 2, 16, 17, 2,
+	18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 0, 31,
+	0, 32, 33, 0, 2, 4, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 34, 35, 36, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 38, 39, 34, 35,
+	36, 40, 41, 1, 1, 7, 4, 2, 2, 2, 2, 2, 4, 2, 2, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+	2, 2, 2, 4, 2, 0, 0, 2, 2, 0, 4, 2, 2, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 4, 2, 2, 4, 2, 2, 4, 4, 4, 2, 4, 4, 2, 4, 2,
+	2, 2, 4, 2, 4, 2, 4, 2, 4, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+	2, 2, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 4,
+	4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 4, 2, 2, 4, 2, 2, 4, 2, 2, 2, 4, 4, 4,
+	37, 38, 39, 2, 2, 2, 4, 2, 2, 4, 4, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 2, 4, 2, 2, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 47, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 15, 15, 0, 15,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 15, 0, 0, 15, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 0, 0, 15, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 47, 47, 0, 0, 0, 0, 15, 15, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0, 47, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 47,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 45, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 52, 52, 52, 52, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 45, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4, 0, 4, 0, 55, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0,
+	0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+	0, 56, 57, 15, 58, 15, 15, 0, 15, 0, 57, 57, 57, 57, 0, 0,
+	57, 15, 2, 2, 45, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0,
+	0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0,
+	0, 0, 0, 0, 0, 0, 0, 46, 0, 45, 45, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, 4, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 2, 2, 4, 0, 4,
+	4, 2, 2, 4, 4, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 0, 9, 4, 4, 4, 4, 4, 2, 2, 4, 4, 4, 4,
+	2, 0, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 4, 0, 0,
+	0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+	2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 14, 59, 4,
+	6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 3, 17, 17, 4, 60, 2, 13, 4, 2, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 15, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 15, 0, 0, 0, 0,
+	0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0,
+	0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 15, 15,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 15, 0, 15, 0, 0,
+	15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 9, 9, 2, 2, 2, 2, 9, 9, 9, 2, 2, 0, 0, 0,
+	0, 2, 0, 0, 0, 9, 9, 2, 4, 2, 9, 9, 4, 4, 4, 4,
+	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 15, 15, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+	2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 17, 3, 16, 61, 61,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 2, 2, 4, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 2,
+	0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+	15, 0, 15, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+	15, 0, 15, 0, 0, 15, 15, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 63, 15,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 0, 15, 0,
+	15, 15, 0, 15, 15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 9, 4, 0, 0, 0, 0, 45,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 2, 2, 2, 4, 2, 4, 4, 4,
+	4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2, 4, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 44, 0, 0, 0, 0, 0,
+	2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 45, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 46, 0, 47, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+	2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 45, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 47, 0, 0,
+	0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+	46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0,
+	0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 46, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15,
+	15, 15, 15, 15, 15, 55, 55, 9, 9, 9, 0, 0, 0, 65, 55, 55,
+	55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+	4, 4, 4, 0, 0, 2, 2, 2, 2, 2, 4, 4, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15,
+	15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2,
+	2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 46, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t __uni_decomp_stage1[3049] = {
+	0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0, 7, 8, 9,
+	10, 11, 0, 12, 0, 0, 0, 0, 13, 0, 0, 14, 0, 0, 0, 0,
+	0, 0, 0, 0, 15, 16, 0, 17, 18, 19, 0, 0, 0, 20, 21, 22,
+	0, 23, 0, 24, 0, 25, 0, 26, 0, 0, 0, 0, 0, 27, 28, 0,
+	29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 31, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 32, 33, 34, 35, 36, 37, 38, 39,
+	40, 0, 0, 0, 41, 0, 42, 43, 44, 45, 46, 47, 48, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 50, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 63, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0,
+	0, 0, 66, 0, 0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 69, 70, 71, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	72, 73, 74, 75, 76, 77, 78, 79, 80,
+};
+
+static const uint16_t __uni_decomp_stage2[5184] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	218, 242, 266, 290, 314, 338, 0, 370, 394, 418, 442, 466, 490, 514, 538, 562,
+	0, 594, 618, 642, 666, 690, 714, 0, 0, 746, 770, 794, 818, 842, 0, 0,
+	890, 906, 922, 938, 954, 970, 0, 986, 1002, 1018, 1034, 1050, 1066, 1082, 1098, 1114,
+	0, 1130, 1146, 1162, 1178, 1194, 1210, 0, 0, 1226, 1242, 1258, 1274, 1290, 0, 1306,
+	1322, 1346, 1362, 1386, 1402, 1426, 1442, 1466, 1482, 1506, 1522, 1546, 1562, 1586, 1602, 1626,
+	0, 0, 1650, 1674, 1690, 1714, 1730, 1754, 1770, 1794, 1810, 1834, 1850, 1874, 1890, 1914,
+	1930, 1954, 1970, 1994, 2010, 2034, 0, 0, 2058, 2082, 2098, 2122, 2138, 2162, 2178, 2202,
+	2218, 0, 0, 0, 2258, 2282, 2298, 2322, 0, 2338, 2362, 2378, 2402, 2418, 2442, 0,
+	0, 0, 0, 2474, 2498, 2514, 2538, 2554, 2578, 0, 0, 0, 2618, 2642, 2658, 2682,
+	2698, 2722, 0, 0, 2746, 2770, 2786, 2810, 2826, 2850, 2866, 2890, 2906, 2930, 2946, 2970,
+	2986, 3010, 3026, 3050, 3066, 3090, 0, 0, 3114, 3138, 3154, 3178, 3194, 3218, 3234, 3258,
+	3274, 3298, 3314, 3338, 3354, 3378, 3394, 3418, 3434, 3458, 3482, 3498, 3522, 3538, 3562, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3746, 3770, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3842,
+	3866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3986, 4010, 4026,
+	4050, 4066, 4090, 4106, 4130, 4147, 4179, 4203, 4235, 4259, 4291, 4315, 4347, 0, 4371, 4403,
+	4427, 4459, 4482, 4506, 0, 0, 4530, 4554, 4570, 4594, 4610, 4634, 4651, 4683, 4706, 4730,
+	4746, 0, 0, 0, 4794, 4818, 0, 0, 4850, 4874, 4891, 4923, 4946, 4970, 4986, 5010,
+	5026, 5050, 5066, 5090, 5106, 5130, 5146, 5170, 5186, 5210, 5226, 5250, 5266, 5290, 5306, 5330,
+	5346, 5370, 5386, 5410, 5426, 5450, 5466, 5490, 5506, 5530, 5546, 5570, 0, 0, 5594, 5618,
+	0, 0, 0, 0, 0, 0, 5658, 5682, 5698, 5722, 5739, 5771, 5795, 5827, 5850, 5874,
+	5891, 5923, 5946, 5970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6089, 6097, 0, 6105, 6114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6169, 0,
+	0, 0, 0, 0, 0, 6186, 6202, 6225, 6234, 6258, 6282, 0, 6306, 0, 6330, 6354,
+	6379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6618, 6642, 6666, 6682, 6698, 6714,
+	6731, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6786, 6802, 6818, 6834, 6850, 0,
+	0, 0, 0, 6890, 6906, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7114, 7138, 0, 7170, 0, 0, 0, 7218, 0, 0, 0, 0, 7274, 7298, 7322, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7426, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7626, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7642, 7658, 0, 7674, 0, 0, 0, 7690, 0, 0, 0, 0, 7706, 7722, 7738, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7842, 7866, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8146, 8170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8234, 8258, 8274, 8298, 0, 0, 8322, 8346, 0, 0, 8370, 8394, 8410, 8434, 8450, 8474,
+	0, 0, 8498, 8522, 8538, 8562, 8578, 8602, 0, 0, 8626, 8650, 8666, 8690, 8706, 8730,
+	8746, 8770, 8786, 8810, 8826, 8850, 0, 0, 8874, 8898, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9450, 9466, 9482, 9498, 9514, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9530, 0, 9546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 9578, 0, 0, 0, 0, 0, 0,
+	0, 9594, 0, 0, 9610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9626, 9642, 9658, 9674, 9690, 9706, 9722, 9738,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9754, 9770, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9786, 9802, 0, 9818,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9834, 0, 0, 9850, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 9866, 9882, 9898, 0, 0, 9914, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9930, 0, 0, 9946, 9962, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9978, 9994, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 10010, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10026, 10042, 10058, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 10074, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	10090, 0, 0, 0, 0, 0, 0, 10106, 10122, 0, 10138, 10155, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10178, 10194, 10210, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10226, 0, 10242, 10259, 10282, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 10298, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10314, 0, 0,
+	0, 0, 10330, 0, 0, 0, 0, 10346, 0, 0, 0, 0, 10362, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 10378, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 10394, 0, 10410, 10426, 0, 10442, 0, 0, 0, 0, 0, 0, 0,
+	0, 10458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 10474, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10490, 0, 0,
+	0, 0, 10506, 0, 0, 0, 0, 10522, 0, 0, 0, 0, 10538, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 10554, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 10570, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 10954, 0, 10970, 0, 10986, 0, 11002, 0, 11018, 0,
+	0, 0, 11034, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11050, 0, 11066, 0, 0,
+	11082, 11098, 0, 11114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	11570, 11594, 11610, 11634, 11650, 11674, 11690, 11714, 11731, 11763, 11786, 11810, 11826, 11850, 11866, 11890,
+	11906, 11930, 11946, 11970, 11987, 12019, 12043, 12075, 12098, 12122, 12138, 12162, 12179, 12211, 12234, 12258,
+	12274, 12298, 12314, 12338, 12354, 12378, 12394, 12418, 12434, 12458, 12474, 12498, 12514, 12538, 12555, 12587,
+	12610, 12634, 12650, 12674, 12690, 12714, 12730, 12754, 12771, 12803, 12826, 12850, 12866, 12890, 12906, 12930,
+	12946, 12970, 12986, 13010, 13026, 13050, 13066, 13090, 13106, 13130, 13146, 13170, 13187, 13219, 13243, 13275,
+	13299, 13331, 13355, 13387, 13410, 13434, 13450, 13474, 13490, 13514, 13530, 13554, 13571, 13603, 13626, 13650,
+	13666, 13690, 13706, 13730, 13747, 13779, 13803, 13835, 13859, 13891, 13914, 13938, 13954, 13978, 13994, 14018,
+	14034, 14058, 14074, 14098, 14114, 14138, 14154, 14178, 14195, 14227, 14251, 14283, 14306, 14330, 14346, 14370,
+	14386, 14410, 14426, 14450, 14466, 14490, 14506, 14530, 14546, 14570, 14586, 14610, 14626, 14650, 14666, 14690,
+	14706, 14730, 14746, 14770, 14786, 14810, 14826, 14858, 14890, 14922, 0, 14970, 0, 0, 0, 0,
+	15010, 15034, 15050, 15074, 15091, 15123, 15147, 15179, 15203, 15235, 15259, 15291, 15315, 15347, 15371, 15403,
+	15427, 15459, 15483, 15515, 15539, 15571, 15595, 15627, 15650, 15674, 15690, 15714, 15730, 15754, 15771, 15803,
+	15827, 15859, 15883, 15915, 15939, 15971, 15995, 16027, 16050, 16074, 16090, 16114, 16130, 16154, 16170, 16194,
+	16211, 16243, 16267, 16299, 16323, 16355, 16379, 16411, 16435, 16467, 16491, 16523, 16547, 16579, 16603, 16635,
+	16659, 16691, 16715, 16747, 16770, 16794, 16810, 16834, 16851, 16883, 16907, 16939, 16963, 16995, 17019, 17051,
+	17075, 17107, 17130, 17154, 17170, 17194, 17210, 17234, 17250, 17274, 0, 0, 0, 0, 0, 0,
+	17314, 17330, 17347, 17371, 17395, 17419, 17443, 17467, 17490, 17514, 17539, 17571, 17603, 17635, 17667, 17699,
+	17730, 17746, 17763, 17787, 17811, 17835, 0, 0, 17858, 17882, 17907, 17939, 17971, 18003, 0, 0,
+	18034, 18050, 18067, 18091, 18115, 18139, 18163, 18187, 18210, 18234, 18259, 18291, 18323, 18355, 18387, 18419,
+	18450, 18466, 18483, 18507, 18531, 18555, 18579, 18603, 18626, 18650, 18675, 18707, 18739, 18771, 18803, 18835,
+	18866, 18882, 18899, 18923, 18947, 18971, 0, 0, 18994, 19018, 19043, 19075, 19107, 19139, 0, 0,
+	19170, 19202, 19219, 19267, 19291, 19339, 19363, 19411, 0, 19434, 0, 19459, 0, 19491, 0, 19523,
+	19554, 19570, 19587, 19611, 19635, 19659, 19683, 19707, 19730, 19754, 19779, 19811, 19843, 19875, 19907, 19939,
+	19970, 19986, 20002, 20018, 20034, 20050, 20066, 20082, 20098, 20114, 20130, 20146, 20162, 20178, 0, 0,
+	20195, 20235, 20276, 20324, 20372, 20420, 20468, 20516, 20563, 20603, 20644, 20692, 20740, 20788, 20836, 20884,
+	20931, 20971, 21012, 21060, 21108, 21156, 21204, 21252, 21299, 21339, 21380, 21428, 21476, 21524, 21572, 21620,
+	21667, 21707, 21748, 21796, 21844, 21892, 21940, 21988, 22035, 22075, 22116, 22164, 22212, 22260, 22308, 22356,
+	22402, 22418, 22435, 22474, 22507, 0, 22546, 22579, 22626, 22650, 22674, 22698, 22722, 0, 22753, 0,
+	0, 22770, 22787, 22826, 22859, 0, 22898, 22931, 22978, 23002, 23026, 23050, 23074, 23106, 23122, 23138,
+	23154, 23170, 23187, 23235, 0, 0, 23282, 23315, 23362, 23386, 23410, 23434, 0, 23458, 23474, 23490,
+	23506, 23522, 23539, 23587, 23634, 23666, 23682, 23715, 23762, 23786, 23810, 23834, 23858, 23882, 23898, 23913,
+	0, 0, 23923, 23962, 23995, 0, 24034, 24067, 24114, 24138, 24162, 24186, 24210, 24241, 0, 0,
+	24249, 24257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 24265, 0, 0, 0, 24281, 24298, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24466, 24482, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24498, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24514, 24530, 24546,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 24562, 0, 0, 0, 0, 24578, 0, 0, 24594, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 24610, 0, 24626, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 24642, 0, 0, 24658, 0, 0, 24674, 0, 24690, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	24706, 0, 24722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24738, 24754, 24770,
+	24786, 24802, 0, 0, 24818, 24834, 0, 0, 24850, 24866, 0, 0, 0, 0, 0, 0,
+	24882, 24898, 0, 0, 24914, 24930, 0, 0, 24946, 24962, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24978, 24994, 25010, 25026,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	25042, 25058, 25074, 25090, 0, 0, 0, 0, 0, 0, 25106, 25122, 25138, 25154, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 25169, 25177, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25394, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26338, 0, 26354, 0,
+	26370, 0, 26386, 0, 26402, 0, 26418, 0, 26434, 0, 26450, 0, 26466, 0, 26482, 0,
+	26498, 0, 26514, 0, 0, 26530, 0, 26546, 0, 26562, 0, 0, 0, 0, 0, 0,
+	26578, 26594, 0, 26610, 26626, 0, 26642, 26658, 0, 26674, 26690, 0, 26706, 26722, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 26738, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26754, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26770, 0, 26786, 0,
+	26802, 0, 26818, 0, 26834, 0, 26850, 0, 26866, 0, 26882, 0, 26898, 0, 26914, 0,
+	26930, 0, 26946, 0, 0, 26962, 0, 26978, 0, 26994, 0, 0, 0, 0, 0, 0,
+	27010, 27026, 0, 27042, 27058, 0, 27074, 27090, 0, 27106, 27122, 0, 27138, 27154, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 27170, 0, 0, 27186, 27202, 27218, 27234, 0, 0, 0, 27250, 0,
+	28889, 28897, 28905, 28913, 28921, 28929, 28937, 28945, 28953, 28961, 28969, 28977, 28985, 28993, 29001, 29009,
+	29017, 29025, 29033, 29041, 29049, 29057, 29065, 29073, 29081, 29089, 29097, 29105, 29113, 29121, 29129, 29137,
+	29145, 29153, 29161, 29169, 29177, 29185, 29193, 29201, 29209, 29217, 29225, 29233, 29241, 29249, 29257, 29265,
+	29273, 29281, 29289, 29297, 29305, 29313, 29321, 29329, 29337, 29345, 29353, 29361, 29369, 29377, 29385, 29393,
+	29401, 29409, 29417, 29425, 29433, 29441, 29449, 29457, 29465, 29473, 29481, 29489, 29497, 29505, 29513, 29521,
+	29529, 29537, 29545, 29553, 29561, 29569, 29577, 29585, 29593, 29601, 29609, 29617, 29625, 29633, 29641, 29649,
+	29657, 29665, 29673, 29681, 29689, 29697, 29705, 29713, 29721, 29729, 29737, 29745, 29753, 29761, 29769, 29777,
+	29785, 29793, 29801, 29809, 29817, 29825, 29833, 29841, 29849, 29857, 29865, 29873, 29881, 29889, 29897, 29905,
+	29913, 29921, 29929, 29937, 29945, 29953, 29961, 29969, 29977, 29985, 29993, 30001, 30009, 30017, 30025, 30033,
+	30041, 30049, 30057, 30065, 30073, 30081, 30089, 30097, 30105, 30113, 30121, 30129, 30137, 30145, 30153, 30161,
+	30169, 30177, 30185, 30193, 30201, 30209, 30217, 30225, 30233, 30241, 30249, 30257, 30265, 30273, 30281, 30289,
+	30297, 30305, 30313, 30321, 30329, 30337, 30345, 30353, 30361, 30369, 30377, 30385, 30393, 30401, 30409, 30417,
+	30425, 30433, 30441, 30449, 30457, 30465, 30473, 30481, 30489, 30497, 30505, 30513, 30521, 30529, 30537, 30545,
+	30553, 30561, 30569, 30577, 30585, 30593, 30601, 30609, 30617, 30625, 30633, 30641, 30649, 30657, 30665, 30673,
+	30681, 30689, 30697, 30705, 30713, 30721, 30729, 30737, 30745, 30753, 30761, 30769, 30777, 30785, 30793, 30801,
+	30809, 30817, 30825, 30833, 30841, 30849, 30857, 30865, 30873, 30881, 30889, 30897, 30905, 30913, 30921, 30929,
+	30937, 30945, 30953, 30961, 30969, 30977, 30985, 30993, 31001, 31009, 31017, 31025, 31033, 31041, 0, 0,
+	31049, 0, 31057, 0, 0, 31065, 31073, 31081, 31089, 31097, 31105, 31113, 31121, 31129, 31137, 0,
+	31145, 0, 31153, 0, 0, 31161, 31169, 0, 0, 0, 31177, 31185, 31193, 31201, 31209, 31217,
+	31225, 31233, 31241, 31249, 31257, 31265, 31273, 31281, 31289, 31297, 31305, 31313, 31321, 31329, 31337, 31345,
+	31353, 31361, 31369, 31377, 31385, 31393, 31401, 31409, 31417, 31425, 31433, 31441, 31449, 31457, 31465, 31473,
+	31481, 31489, 31497, 31505, 31513, 31521, 31529, 31537, 31545, 31553, 31561, 31569, 31577, 31585, 31593, 31601,
+	31609, 31617, 31625, 31633, 31641, 31649, 31657, 31665, 31673, 31681, 31689, 31697, 31705, 31713, 0, 0,
+	31721, 31729, 31737, 31745, 31753, 31761, 31769, 31777, 31785, 31793, 31801, 31809, 31817, 31825, 31833, 31841,
+	31849, 31857, 31865, 31873, 31881, 31889, 31897, 31905, 31913, 31921, 31929, 31937, 31945, 31953, 31961, 31969,
+	31977, 31985, 31993, 32001, 32009, 32017, 32025, 32033, 32041, 32049, 32057, 32065, 32073, 32081, 32089, 32097,
+	32105, 32113, 32121, 32129, 32137, 32145, 32153, 32161, 32169, 32177, 32185, 32193, 32201, 32209, 32217, 32225,
+	32233, 32241, 32249, 32257, 32265, 32273, 32281, 32289, 32297, 32305, 32313, 32321, 32329, 32337, 32345, 32353,
+	32361, 32369, 32377, 32385, 32393, 32401, 32409, 32417, 32425, 32433, 32441, 32449, 32457, 32465, 32473, 32481,
+	32489, 32497, 32505, 32513, 32521, 32529, 32537, 32545, 32553, 32561, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32778, 0, 32794,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32810, 32826, 32843, 32867, 32890, 32906,
+	32922, 32938, 32954, 32970, 32986, 33002, 33018, 0, 33034, 33050, 33066, 33082, 33098, 0, 33114, 0,
+	33130, 33146, 0, 33162, 33178, 0, 33194, 33210, 33226, 33242, 33258, 33274, 33290, 33306, 33322, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34842, 0, 34858, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34874, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34890, 34906,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34922, 34938, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34954, 34970, 0, 34986, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35002, 35018, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 35290, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35562, 35578,
+	35595, 35619, 35643, 35667, 35691, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35714, 35730, 35747, 35771, 35795,
+	35819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	36113, 36121, 36129, 36137, 36145, 36153, 36161, 36169, 36177, 36185, 36193, 36201, 36209, 36217, 36225, 36233,
+	36241, 36249, 36257, 36265, 36273, 36281, 36289, 36297, 36305, 36313, 36321, 36329, 36337, 36345, 36353, 36361,
+	36369, 36377, 36385, 36393, 36401, 36409, 36417, 36425, 36433, 36441, 36449, 36457, 36465, 36473, 36481, 36489,
+	36497, 36505, 36513, 36521, 36529, 36537, 36545, 36553, 36561, 36569, 36577, 36585, 36593, 36601, 36609, 36617,
+	36625, 36633, 36641, 36649, 36657, 36665, 36673, 36681, 36689, 36697, 36705, 36713, 36721, 36729, 36737, 36745,
+	36753, 36761, 36769, 36777, 36785, 36793, 36801, 36809, 36817, 36825, 36833, 36841, 36849, 36857, 36865, 36873,
+	36881, 36889, 36897, 36905, 36913, 36921, 36929, 36937, 36945, 36953, 36961, 36969, 36977, 36985, 36993, 37001,
+	37009, 37017, 37025, 37033, 37041, 37049, 37057, 37065, 37073, 37081, 37089, 37097, 37105, 37113, 37121, 37129,
+	37137, 37145, 37153, 37161, 37169, 37177, 37185, 37193, 37201, 37209, 37217, 37225, 37233, 37241, 37249, 37257,
+	37265, 37273, 37281, 37289, 37297, 37305, 37313, 37321, 37329, 37337, 37345, 37353, 37361, 37369, 37377, 37385,
+	37393, 37401, 37409, 37417, 37425, 37433, 37441, 37449, 37457, 37465, 37473, 37481, 37489, 37497, 37505, 37513,
+	37521, 37529, 37537, 37545, 37553, 37561, 37569, 37577, 37585, 37593, 37601, 37609, 37617, 37625, 37633, 37641,
+	37649, 37657, 37665, 37673, 37681, 37689, 37697, 37705, 37713, 37721, 37729, 37737, 37745, 37753, 37761, 37769,
+	37777, 37785, 37793, 37801, 37809, 37817, 37825, 37833, 37841, 37849, 37857, 37865, 37873, 37881, 37889, 37897,
+	37905, 37913, 37921, 37929, 37937, 37945, 37953, 37961, 37969, 37977, 37985, 37993, 38001, 38009, 38017, 38025,
+	38033, 38041, 38049, 38057, 38065, 38073, 38081, 38089, 38097, 38105, 38113, 38121, 38129, 38137, 38145, 38153,
+	38161, 38169, 38177, 38185, 38193, 38201, 38209, 38217, 38225, 38233, 38241, 38249, 38257, 38265, 38273, 38281,
+	38289, 38297, 38305, 38313, 38321, 38329, 38337, 38345, 38353, 38361, 38369, 38377, 38385, 38393, 38401, 38409,
+	38417, 38425, 38433, 38441, 38449, 38457, 38465, 38473, 38481, 38489, 38497, 38505, 38513, 38521, 38529, 38537,
+	38545, 38553, 38561, 38569, 38577, 38585, 38593, 38601, 38609, 38617, 38625, 38633, 38641, 38649, 38657, 38665,
+	38673, 38681, 38689, 38697, 38705, 38713, 38721, 38729, 38737, 38745, 38753, 38761, 38769, 38777, 38785, 38793,
+	38801, 38809, 38817, 38825, 38833, 38841, 38849, 38857, 38865, 38873, 38881, 38889, 38897, 38905, 38913, 38921,
+	38929, 38937, 38945, 38953, 38961, 38969, 38977, 38985, 38993, 39001, 39009, 39017, 39025, 39033, 39041, 39049,
+	39057, 39065, 39073, 39081, 39089, 39097, 39105, 39113, 39121, 39129, 39137, 39145, 39153, 39161, 39169, 39177,
+	39185, 39193, 39201, 39209, 39217, 39225, 39233, 39241, 39249, 39257, 39265, 39273, 39281, 39289, 39297, 39305,
+	39313, 39321, 39329, 39337, 39345, 39353, 39361, 39369, 39377, 39385, 39393, 39401, 39409, 39417, 39425, 39433,
+	39441, 39449, 39457, 39465, 39473, 39481, 39489, 39497, 39505, 39513, 39521, 39529, 39537, 39545, 39553, 39561,
+	39569, 39577, 39585, 39593, 39601, 39609, 39617, 39625, 39633, 39641, 39649, 39657, 39665, 39673, 39681, 39689,
+	39697, 39705, 39713, 39721, 39729, 39737, 39745, 39753, 39761, 39769, 39777, 39785, 39793, 39801, 39809, 39817,
+	39825, 39833, 39841, 39849, 39857, 39865, 39873, 39881, 39889, 39897, 39905, 39913, 39921, 39929, 39937, 39945,
+	39953, 39961, 39969, 39977, 39985, 39993, 40001, 40009, 40017, 40025, 40033, 40041, 40049, 40057, 40065, 40073,
+	40081, 40089, 40097, 40105, 40113, 40121, 40129, 40137, 40145, 40153, 40161, 40169, 40177, 40185, 40193, 40201,
+	40209, 40217, 40225, 40233, 40241, 40249, 40257, 40265, 40273, 40281, 40289, 40297, 40305, 40313, 40321, 40329,
+	40337, 40345, 40353, 40361, 40369, 40377, 40385, 40393, 40401, 40409, 40417, 40425, 40433, 40441, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t __uni_fold_stage1[3049] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 10, 11, 12,
+	13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 20, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 23, 0, 0, 0, 0, 0, 24, 25, 26, 27, 28, 29, 30, 31,
+	0, 0, 0, 0, 32, 33, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	37, 38, 39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 43, 44, 45, 46,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 48, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	51, 0, 52, 53, 0, 54, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t __uni_fold_stage2[3840] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 9, 17, 25, 33, 41, 49, 57, 65, 73, 81, 89, 97, 105, 113,
+	121, 129, 137, 145, 153, 161, 169, 177, 185, 193, 201, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	233, 257, 281, 305, 329, 353, 361, 385, 409, 433, 457, 481, 505, 529, 553, 577,
+	585, 609, 633, 657, 681, 705, 729, 0, 737, 761, 785, 809, 833, 857, 865, 874,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1337, 0, 1377, 0, 1417, 0, 1457, 0, 1497, 0, 1537, 0, 1577, 0, 1617, 0,
+	1641, 0, 1665, 0, 1705, 0, 1745, 0, 1785, 0, 1825, 0, 1865, 0, 1905, 0,
+	1945, 0, 1985, 0, 2025, 0, 2049, 0, 2073, 0, 2113, 0, 2153, 0, 2193, 0,
+	2234, 0, 2249, 0, 2273, 0, 2313, 0, 0, 2353, 0, 2393, 0, 2433, 0, 2457,
+	0, 2465, 0, 2489, 0, 2529, 0, 2569, 0, 2594, 2609, 0, 2633, 0, 2673, 0,
+	2713, 0, 2737, 0, 2761, 0, 2801, 0, 2841, 0, 2881, 0, 2921, 0, 2961, 0,
+	3001, 0, 3041, 0, 3081, 0, 3105, 0, 3129, 0, 3169, 0, 3209, 0, 3249, 0,
+	3289, 0, 3329, 0, 3369, 0, 3409, 0, 3449, 3473, 0, 3513, 0, 3553, 0, 3577,
+	0, 3585, 3593, 0, 3601, 0, 3609, 3617, 0, 3625, 3633, 3641, 0, 0, 3649, 3657,
+	3665, 3673, 0, 3681, 3689, 0, 3697, 3705, 3713, 0, 0, 0, 3721, 3729, 0, 3737,
+	3761, 0, 3785, 0, 3793, 0, 3801, 3809, 0, 3817, 0, 0, 3825, 0, 3833, 3857,
+	0, 3881, 3889, 3897, 0, 3905, 0, 3913, 3921, 0, 0, 0, 3929, 0, 0, 0,
+	0, 0, 0, 0, 3937, 3945, 0, 3953, 3961, 0, 3969, 3977, 0, 4001, 0, 4041,
+	0, 4081, 0, 4121, 0, 4169, 0, 4225, 0, 4281, 0, 4337, 0, 0, 4393, 0,
+	4449, 0, 4497, 0, 4521, 0, 4545, 0, 4585, 0, 4625, 0, 4673, 0, 4721, 0,
+	4762, 4777, 4785, 0, 4809, 0, 4833, 4841, 4865, 0, 4913, 0, 4961, 0, 5001, 0,
+	5041, 0, 5081, 0, 5121, 0, 5161, 0, 5201, 0, 5241, 0, 5281, 0, 5321, 0,
+	5361, 0, 5401, 0, 5441, 0, 5481, 0, 5521, 0, 5561, 0, 5585, 0, 5609, 0,
+	5633, 0, 5641, 0, 5649, 0, 5673, 0, 5713, 0, 5761, 0, 5817, 0, 5865, 0,
+	5913, 0, 5961, 0, 0, 0, 0, 0, 0, 0, 5985, 5993, 0, 6001, 6009, 0,
+	0, 6017, 0, 6025, 6033, 6041, 6049, 0, 6057, 0, 6065, 0, 6073, 0, 6081, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6137, 0, 6145, 0, 0, 0, 6161, 0, 0, 0, 0, 0, 0, 0, 0, 6177,
+	0, 0, 0, 0, 0, 0, 6217, 0, 6249, 6273, 6297, 0, 6321, 0, 6345, 6369,
+	6403, 6425, 6433, 6441, 6449, 6457, 6465, 6473, 6481, 6489, 6497, 6505, 6513, 6521, 6529, 6537,
+	6545, 6553, 0, 6561, 6569, 6577, 6585, 6593, 6601, 6609, 6633, 6657, 0, 0, 0, 0,
+	6755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6777, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6865,
+	6873, 6881, 0, 0, 0, 6921, 6929, 0, 6937, 0, 6945, 0, 6953, 0, 6961, 0,
+	6969, 0, 6977, 0, 6985, 0, 6993, 0, 7001, 0, 7009, 0, 7017, 0, 7025, 0,
+	7033, 7041, 0, 0, 7049, 7057, 0, 7065, 0, 7073, 7081, 0, 0, 7089, 7097, 7105,
+	7129, 7153, 7161, 7185, 7193, 7201, 7209, 7233, 7241, 7249, 7257, 7265, 7289, 7313, 7337, 7345,
+	7353, 7361, 7369, 7377, 7385, 7393, 7401, 7409, 7417, 7441, 7449, 7457, 7465, 7473, 7481, 7489,
+	7497, 7505, 7513, 7521, 7529, 7537, 7545, 7553, 7561, 7569, 7577, 7585, 7593, 7601, 7609, 7617,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7753, 0, 7761, 0, 7769, 0, 7777, 0, 7785, 0, 7793, 0, 7801, 0, 7809, 0,
+	7817, 0, 7825, 0, 7833, 0, 7857, 0, 7881, 0, 7889, 0, 7897, 0, 7905, 0,
+	7913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7921, 0, 7929, 0, 7937, 0,
+	7945, 0, 7953, 0, 7961, 0, 7969, 0, 7977, 0, 7985, 0, 7993, 0, 8001, 0,
+	8009, 0, 8017, 0, 8025, 0, 8033, 0, 8041, 0, 8049, 0, 8057, 0, 8065, 0,
+	8073, 0, 8081, 0, 8089, 0, 8097, 0, 8105, 0, 8113, 0, 8121, 0, 8129, 0,
+	8137, 8161, 0, 8185, 0, 8193, 0, 8201, 0, 8209, 0, 8217, 0, 8225, 0, 0,
+	8249, 0, 8289, 0, 8313, 0, 8337, 0, 8361, 0, 8385, 0, 8425, 0, 8465, 0,
+	8489, 0, 8513, 0, 8553, 0, 8593, 0, 8617, 0, 8641, 0, 8681, 0, 8721, 0,
+	8761, 0, 8801, 0, 8841, 0, 8865, 0, 8889, 0, 8913, 0, 8921, 0, 8929, 0,
+	8937, 0, 8945, 0, 8953, 0, 8961, 0, 8969, 0, 8977, 0, 8985, 0, 8993, 0,
+	9001, 0, 9009, 0, 9017, 0, 9025, 0, 9033, 0, 9041, 0, 9049, 0, 9057, 0,
+	9065, 0, 9073, 0, 9081, 0, 9089, 0, 9097, 0, 9105, 0, 9113, 0, 9121, 0,
+	0, 9129, 9137, 9145, 9153, 9161, 9169, 9177, 9185, 9193, 9201, 9209, 9217, 9225, 9233, 9241,
+	9249, 9257, 9265, 9273, 9281, 9289, 9297, 9305, 9313, 9321, 9329, 9337, 9345, 9353, 9361, 9369,
+	9377, 9385, 9393, 9401, 9409, 9417, 9425, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9434, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	10585, 10593, 10601, 10609, 10617, 10625, 10633, 10641, 10649, 10657, 10665, 10673, 10681, 10689, 10697, 10705,
+	10713, 10721, 10729, 10737, 10745, 10753, 10761, 10769, 10777, 10785, 10793, 10801, 10809, 10817, 10825, 10833,
+	10841, 10849, 10857, 10865, 10873, 10881, 0, 10889, 0, 0, 0, 0, 0, 10897, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 10905, 10913, 10921, 10929, 10937, 10945, 0, 0,
+	11129, 11137, 11145, 11153, 11161, 11169, 11177, 11185, 11193, 0, 0, 0, 0, 0, 0, 0,
+	11201, 11209, 11217, 11225, 11233, 11241, 11249, 11257, 11265, 11273, 11281, 11289, 11297, 11305, 11313, 11321,
+	11329, 11337, 11345, 11353, 11361, 11369, 11377, 11385, 11393, 11401, 11409, 11417, 11425, 11433, 11441, 11449,
+	11457, 11465, 11473, 11481, 11489, 11497, 11505, 11513, 11521, 11529, 11537, 0, 0, 11545, 11553, 11561,
+	11585, 0, 11625, 0, 11665, 0, 11705, 0, 11753, 0, 11801, 0, 11841, 0, 11881, 0,
+	11921, 0, 11961, 0, 12009, 0, 12065, 0, 12113, 0, 12153, 0, 12201, 0, 12249, 0,
+	12289, 0, 12329, 0, 12369, 0, 12409, 0, 12449, 0, 12489, 0, 12529, 0, 12577, 0,
+	12625, 0, 12665, 0, 12705, 0, 12745, 0, 12793, 0, 12841, 0, 12881, 0, 12921, 0,
+	12961, 0, 13001, 0, 13041, 0, 13081, 0, 13121, 0, 13161, 0, 13209, 0, 13265, 0,
+	13321, 0, 13377, 0, 13425, 0, 13465, 0, 13505, 0, 13545, 0, 13593, 0, 13641, 0,
+	13681, 0, 13721, 0, 13769, 0, 13825, 0, 13881, 0, 13929, 0, 13969, 0, 14009, 0,
+	14049, 0, 14089, 0, 14129, 0, 14169, 0, 14217, 0, 14273, 0, 14321, 0, 14361, 0,
+	14401, 0, 14441, 0, 14481, 0, 14521, 0, 14561, 0, 14601, 0, 14641, 0, 14681, 0,
+	14721, 0, 14761, 0, 14801, 0, 14842, 14874, 14906, 14938, 14954, 14985, 0, 0, 14994, 0,
+	15025, 0, 15065, 0, 15113, 0, 15169, 0, 15225, 0, 15281, 0, 15337, 0, 15393, 0,
+	15449, 0, 15505, 0, 15561, 0, 15617, 0, 15665, 0, 15705, 0, 15745, 0, 15793, 0,
+	15849, 0, 15905, 0, 15961, 0, 16017, 0, 16065, 0, 16105, 0, 16145, 0, 16185, 0,
+	16233, 0, 16289, 0, 16345, 0, 16401, 0, 16457, 0, 16513, 0, 16569, 0, 16625, 0,
+	16681, 0, 16737, 0, 16785, 0, 16825, 0, 16873, 0, 16929, 0, 16985, 0, 17041, 0,
+	17097, 0, 17145, 0, 17185, 0, 17225, 0, 17265, 0, 17289, 0, 17297, 0, 17305, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 17505, 17529, 17561, 17593, 17625, 17657, 17689, 17721,
+	0, 0, 0, 0, 0, 0, 0, 0, 17873, 17897, 17929, 17961, 17993, 18025, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 18225, 18249, 18281, 18313, 18345, 18377, 18409, 18441,
+	0, 0, 0, 0, 0, 0, 0, 0, 18641, 18665, 18697, 18729, 18761, 18793, 18825, 18857,
+	0, 0, 0, 0, 0, 0, 0, 0, 19009, 19033, 19065, 19097, 19129, 19161, 0, 0,
+	19186, 0, 19243, 0, 19315, 0, 19387, 0, 0, 19449, 0, 19481, 0, 19513, 0, 19545,
+	0, 0, 0, 0, 0, 0, 0, 0, 19745, 19769, 19801, 19833, 19865, 19897, 19929, 19961,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	20218, 20258, 20306, 20354, 20402, 20450, 20498, 20546, 20586, 20626, 20674, 20722, 20770, 20818, 20866, 20914,
+	20954, 20994, 21042, 21090, 21138, 21186, 21234, 21282, 21322, 21362, 21410, 21458, 21506, 21554, 21602, 21650,
+	21690, 21730, 21778, 21826, 21874, 21922, 21970, 22018, 22058, 22098, 22146, 22194, 22242, 22290, 22338, 22386,
+	0, 0, 22458, 22490, 22530, 0, 22562, 22603, 22641, 22665, 22689, 22713, 22738, 0, 22761, 0,
+	0, 0, 22810, 22842, 22882, 0, 22914, 22955, 22993, 23017, 23041, 23065, 23090, 0, 0, 0,
+	0, 0, 23211, 23259, 0, 0, 23298, 23339, 23377, 23401, 23425, 23449, 0, 0, 0, 0,
+	0, 0, 23563, 23611, 23650, 0, 23698, 23739, 23777, 23801, 23825, 23849, 23873, 0, 0, 0,
+	0, 0, 23946, 23978, 24018, 0, 24050, 24091, 24129, 24153, 24177, 24201, 24226, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 24273, 0, 0, 0, 24289, 24313, 0, 0, 0, 0,
+	0, 0, 24321, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	24329, 24337, 24345, 24353, 24361, 24369, 24377, 24385, 24393, 24401, 24409, 24417, 24425, 24433, 24441, 24449,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 24457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 25185, 25193, 25201, 25209, 25217, 25225, 25233, 25241, 25249, 25257,
+	25265, 25273, 25281, 25289, 25297, 25305, 25313, 25321, 25329, 25337, 25345, 25353, 25361, 25369, 25377, 25385,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	25409, 25417, 25425, 25433, 25441, 25449, 25457, 25465, 25473, 25481, 25489, 25497, 25505, 25513, 25521, 25529,
+	25537, 25545, 25553, 25561, 25569, 25577, 25585, 25593, 25601, 25609, 25617, 25625, 25633, 25641, 25649, 25657,
+	25665, 25673, 25681, 25689, 25697, 25705, 25713, 25721, 25729, 25737, 25745, 25753, 25761, 25769, 25777, 25785,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	25793, 0, 25801, 25809, 25817, 0, 0, 25825, 0, 25833, 0, 25841, 0, 25849, 25857, 25865,
+	25873, 0, 25881, 0, 0, 25889, 0, 0, 0, 0, 0, 0, 0, 0, 25897, 25905,
+	25913, 0, 25921, 0, 25929, 0, 25937, 0, 25945, 0, 25953, 0, 25961, 0, 25969, 0,
+	25977, 0, 25985, 0, 25993, 0, 26001, 0, 26009, 0, 26017, 0, 26025, 0, 26033, 0,
+	26041, 0, 26049, 0, 26057, 0, 26065, 0, 26073, 0, 26081, 0, 26089, 0, 26097, 0,
+	26105, 0, 26113, 0, 26121, 0, 26129, 0, 26137, 0, 26145, 0, 26153, 0, 26161, 0,
+	26169, 0, 26177, 0, 26185, 0, 26193, 0, 26201, 0, 26209, 0, 26217, 0, 26225, 0,
+	26233, 0, 26241, 0, 26249, 0, 26257, 0, 26265, 0, 26273, 0, 26281, 0, 26289, 0,
+	26297, 0, 26305, 0, 0, 0, 0, 0, 0, 0, 0, 26313, 0, 26321, 0, 0,
+	0, 0, 26329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27265, 0, 27273, 0, 27281, 0, 27289, 0, 27297, 0, 27305, 0, 27313, 0, 27321, 0,
+	27329, 0, 27337, 0, 27345, 0, 27353, 0, 27361, 0, 27369, 0, 27377, 0, 27385, 0,
+	27393, 0, 27401, 0, 27409, 0, 27417, 0, 27425, 0, 27433, 0, 27441, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27449, 0, 27457, 0, 27465, 0, 27473, 0, 27481, 0, 27489, 0, 27497, 0, 27505, 0,
+	27513, 0, 27521, 0, 27529, 0, 27537, 0, 27545, 0, 27553, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 27561, 0, 27569, 0, 27577, 0, 27585, 0, 27593, 0, 27601, 0, 27609, 0,
+	0, 0, 27617, 0, 27625, 0, 27633, 0, 27641, 0, 27649, 0, 27657, 0, 27665, 0,
+	27673, 0, 27681, 0, 27689, 0, 27697, 0, 27705, 0, 27713, 0, 27721, 0, 27729, 0,
+	27737, 0, 27745, 0, 27753, 0, 27761, 0, 27769, 0, 27777, 0, 27785, 0, 27793, 0,
+	27801, 0, 27809, 0, 27817, 0, 27825, 0, 27833, 0, 27841, 0, 27849, 0, 27857, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 27865, 0, 27873, 0, 27881, 27889, 0,
+	27897, 0, 27905, 0, 27913, 0, 27921, 0, 0, 0, 0, 27929, 0, 27937, 0, 0,
+	27945, 0, 27953, 0, 0, 0, 27961, 0, 27969, 0, 27977, 0, 27985, 0, 27993, 0,
+	28001, 0, 28009, 0, 28017, 0, 28025, 0, 28033, 0, 28041, 28049, 28057, 28065, 28073, 0,
+	28081, 28089, 28097, 28105, 28113, 0, 28121, 0, 28129, 0, 28137, 0, 28145, 0, 28153, 0,
+	28161, 0, 28169, 0, 28177, 28185, 28193, 28201, 0, 28209, 0, 0, 0, 0, 0, 0,
+	28217, 0, 0, 0, 0, 0, 28225, 0, 28233, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 28241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	28249, 28257, 28265, 28273, 28281, 28289, 28297, 28305, 28313, 28321, 28329, 28337, 28345, 28353, 28361, 28369,
+	28377, 28385, 28393, 28401, 28409, 28417, 28425, 28433, 28441, 28449, 28457, 28465, 28473, 28481, 28489, 28497,
+	28505, 28513, 28521, 28529, 28537, 28545, 28553, 28561, 28569, 28577, 28585, 28593, 28601, 28609, 28617, 28625,
+	28633, 28641, 28649, 28657, 28665, 28673, 28681, 28689, 28697, 28705, 28713, 28721, 28729, 28737, 28745, 28753,
+	28761, 28769, 28777, 28785, 28793, 28801, 28809, 28817, 28825, 28833, 28841, 28849, 28857, 28865, 28873, 28881,
+	32570, 32586, 32602, 32619, 32643, 32666, 32682, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 32698, 32714, 32730, 32746, 32762, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 33337, 33345, 33353, 33361, 33369, 33377, 33385, 33393, 33401, 33409, 33417, 33425, 33433, 33441, 33449,
+	33457, 33465, 33473, 33481, 33489, 33497, 33505, 33513, 33521, 33529, 33537, 0, 0, 0, 0, 0,
+	33545, 33553, 33561, 33569, 33577, 33585, 33593, 33601, 33609, 33617, 33625, 33633, 33641, 33649, 33657, 33665,
+	33673, 33681, 33689, 33697, 33705, 33713, 33721, 33729, 33737, 33745, 33753, 33761, 33769, 33777, 33785, 33793,
+	33801, 33809, 33817, 33825, 33833, 33841, 33849, 33857, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33865, 33873, 33881, 33889, 33897, 33905, 33913, 33921, 33929, 33937, 33945, 33953, 33961, 33969, 33977, 33985,
+	33993, 34001, 34009, 34017, 34025, 34033, 34041, 34049, 34057, 34065, 34073, 34081, 34089, 34097, 34105, 34113,
+	34121, 34129, 34137, 34145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	34153, 34161, 34169, 34177, 34185, 34193, 34201, 34209, 34217, 34225, 34233, 0, 34241, 34249, 34257, 34265,
+	34273, 34281, 34289, 34297, 34305, 34313, 34321, 34329, 34337, 34345, 34353, 0, 34361, 34369, 34377, 34385,
+	34393, 34401, 34409, 0, 34417, 34425, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	34433, 34441, 34449, 34457, 34465, 34473, 34481, 34489, 34497, 34505, 34513, 34521, 34529, 34537, 34545, 34553,
+	34561, 34569, 34577, 34585, 34593, 34601, 34609, 34617, 34625, 34633, 34641, 34649, 34657, 34665, 34673, 34681,
+	34689, 34697, 34705, 34713, 34721, 34729, 34737, 34745, 34753, 34761, 34769, 34777, 34785, 34793, 34801, 34809,
+	34817, 34825, 34833, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	35033, 35041, 35049, 35057, 35065, 35073, 35081, 35089, 35097, 35105, 35113, 35121, 35129, 35137, 35145, 35153,
+	35161, 35169, 35177, 35185, 35193, 35201, 35209, 35217, 35225, 35233, 35241, 35249, 35257, 35265, 35273, 35281,
+	35305, 35313, 35321, 35329, 35337, 35345, 35353, 35361, 35369, 35377, 35385, 35393, 35401, 35409, 35417, 35425,
+	35433, 35441, 35449, 35457, 35465, 35473, 35481, 35489, 35497, 35505, 35513, 35521, 35529, 35537, 35545, 35553,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	35841, 35849, 35857, 35865, 35873, 35881, 35889, 35897, 35905, 35913, 35921, 35929, 35937, 35945, 35953, 35961,
+	35969, 35977, 35985, 35993, 36001, 36009, 36017, 36025, 36033, 36041, 36049, 36057, 36065, 36073, 36081, 36089,
+	36097, 36105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint32_t __uni_data[5056] = {
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+	0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+	0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+	0x0079, 0x007A, 0x03BC, 0x0041, 0x0300, 0x00E0, 0x0041, 0x0301,
+	0x00E1, 0x0041, 0x0302, 0x00E2, 0x0041, 0x0303, 0x00E3, 0x0041,
+	0x0308, 0x00E4, 0x0041, 0x030A, 0x00E5, 0x00E6, 0x0043, 0x0327,
+	0x00E7, 0x0045, 0x0300, 0x00E8, 0x0045, 0x0301, 0x00E9, 0x0045,
+	0x0302, 0x00EA, 0x0045, 0x0308, 0x00EB, 0x0049, 0x0300, 0x00EC,
+	0x0049, 0x0301, 0x00ED, 0x0049, 0x0302, 0x00EE, 0x0049, 0x0308,
+	0x00EF, 0x00F0, 0x004E, 0x0303, 0x00F1, 0x004F, 0x0300, 0x00F2,
+	0x004F, 0x0301, 0x00F3, 0x004F, 0x0302, 0x00F4, 0x004F, 0x0303,
+	0x00F5, 0x004F, 0x0308, 0x00F6, 0x00F8, 0x0055, 0x0300, 0x00F9,
+	0x0055, 0x0301, 0x00FA, 0x0055, 0x0302, 0x00FB, 0x0055, 0x0308,
+	0x00FC, 0x0059, 0x0301, 0x00FD, 0x00FE, 0x0073, 0x0073, 0x0061,
+	0x0300, 0x0061, 0x0301, 0x0061, 0x0302, 0x0061, 0x0303, 0x0061,
+	0x0308, 0x0061, 0x030A, 0x0063, 0x0327, 0x0065, 0x0300, 0x0065,
+	0x0301, 0x0065, 0x0302, 0x0065, 0x0308, 0x0069, 0x0300, 0x0069,
+	0x0301, 0x0069, 0x0302, 0x0069, 0x0308, 0x006E, 0x0303, 0x006F,
+	0x0300, 0x006F, 0x0301, 0x006F, 0x0302, 0x006F, 0x0303, 0x006F,
+	0x0308, 0x0075, 0x0300, 0x0075, 0x0301, 0x0075, 0x0302, 0x0075,
+	0x0308, 0x0079, 0x0301, 0x0079, 0x0308, 0x0041, 0x0304, 0x0101,
+	0x0061, 0x0304, 0x0041, 0x0306, 0x0103, 0x0061, 0x0306, 0x0041,
+	0x0328, 0x0105, 0x0061, 0x0328, 0x0043, 0x0301, 0x0107, 0x0063,
+	0x0301, 0x0043, 0x0302, 0x0109, 0x0063, 0x0302, 0x0043, 0x0307,
+	0x010B, 0x0063, 0x0307, 0x0043, 0x030C, 0x010D, 0x0063, 0x030C,
+	0x0044, 0x030C, 0x010F, 0x0064, 0x030C, 0x0111, 0x0045, 0x0304,
+	0x0113, 0x0065, 0x0304, 0x0045, 0x0306, 0x0115, 0x0065, 0x0306,
+	0x0045, 0x0307, 0x0117, 0x0065, 0x0307, 0x0045, 0x0328, 0x0119,
+	0x0065, 0x0328, 0x0045, 0x030C, 0x011B, 0x0065, 0x030C, 0x0047,
+	0x0302, 0x011D, 0x0067, 0x0302, 0x0047, 0x0306, 0x011F, 0x0067,
+	0x0306, 0x0047, 0x0307, 0x0121, 0x0067, 0x0307, 0x0047, 0x0327,
+	0x0123, 0x0067, 0x0327, 0x0048, 0x0302, 0x0125, 0x0068, 0x0302,
+	0x0127, 0x0049, 0x0303, 0x0129, 0x0069, 0x0303, 0x0049, 0x0304,
+	0x012B, 0x0069, 0x0304, 0x0049, 0x0306, 0x012D, 0x0069, 0x0306,
+	0x0049, 0x0328, 0x012F, 0x0069, 0x0328, 0x0049, 0x0307, 0x0069,
+	0x0307, 0x0133, 0x004A, 0x0302, 0x0135, 0x006A, 0x0302, 0x004B,
+	0x0327, 0x0137, 0x006B, 0x0327, 0x004C, 0x0301, 0x013A, 0x006C,
+	0x0301, 0x004C, 0x0327, 0x013C, 0x006C, 0x0327, 0x004C, 0x030C,
+	0x013E, 0x006C, 0x030C, 0x0140, 0x0142, 0x004E, 0x0301, 0x0144,
+	0x006E, 0x0301, 0x004E, 0x0327, 0x0146, 0x006E, 0x0327, 0x004E,
+	0x030C, 0x0148, 0x006E, 0x030C, 0x02BC, 0x006E, 0x014B, 0x004F,
+	0x0304, 0x014D, 0x006F, 0x0304, 0x004F, 0x0306, 0x014F, 0x006F,
+	0x0306, 0x004F, 0x030B, 0x0151, 0x006F, 0x030B, 0x0153, 0x0052,
+	0x0301, 0x0155, 0x0072, 0x0301, 0x0052, 0x0327, 0x0157, 0x0072,
+	0x0327, 0x0052, 0x030C, 0x0159, 0x0072, 0x030C, 0x0053, 0x0301,
+	0x015B, 0x0073, 0x0301, 0x0053, 0x0302, 0x015D, 0x0073, 0x0302,
+	0x0053, 0x0327, 0x015F, 0x0073, 0x0327, 0x0053, 0x030C, 0x0161,
+	0x0073, 0x030C, 0x0054, 0x0327, 0x0163, 0x0074, 0x0327, 0x0054,
+	0x030C, 0x0165, 0x0074, 0x030C, 0x0167, 0x0055, 0x0303, 0x0169,
+	0x0075, 0x0303, 0x0055, 0x0304, 0x016B, 0x0075, 0x0304, 0x0055,
+	0x0306, 0x016D, 0x0075, 0x0306, 0x0055, 0x030A, 0x016F, 0x0075,
+	0x030A, 0x0055, 0x030B, 0x0171, 0x0075, 0x030B, 0x0055, 0x0328,
+	0x0173, 0x0075, 0x0328, 0x0057, 0x0302, 0x0175, 0x0077, 0x0302,
+	0x0059, 0x0302, 0x0177, 0x0079, 0x0302, 0x0059, 0x0308, 0x00FF,
+	0x005A, 0x0301, 0x017A, 0x007A, 0x0301, 0x005A, 0x0307, 0x017C,
+	0x007A, 0x0307, 0x005A, 0x030C, 0x017E, 0x007A, 0x030C, 0x0073,
+	0x0253, 0x0183, 0x0185, 0x0254, 0x0188, 0x0256, 0x0257, 0x018C,
+	0x01DD, 0x0259, 0x025B, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268,
+	0x0199, 0x026F, 0x0272, 0x0275, 0x004F, 0x031B, 0x01A1, 0x006F,
+	0x031B, 0x01A3, 0x01A5, 0x0280, 0x01A8, 0x0283, 0x01AD, 0x0288,
+	0x0055, 0x031B, 0x01B0, 0x0075, 0x031B, 0x028A, 0x028B, 0x01B4,
+	0x01B6, 0x0292, 0x01B9, 0x01BD, 0x01C6, 0x01C6, 0x01C9, 0x01C9,
+	0x01CC, 0x01CC, 0x0041, 0x030C, 0x01CE, 0x0061, 0x030C, 0x0049,
+	0x030C, 0x01D0, 0x0069, 0x030C, 0x004F, 0x030C, 0x01D2, 0x006F,
+	0x030C, 0x0055, 0x030C, 0x01D4, 0x0075, 0x030C, 0x0055, 0x0308,
+	0x0304, 0x01D6, 0x0075, 0x0308, 0x0304, 0x0055, 0x0308, 0x0301,
+	0x01D8, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308, 0x030C, 0x01DA,
+	0x0075, 0x0308, 0x030C, 0x0055, 0x0308, 0x0300, 0x01DC, 0x0075,
+	0x0308, 0x0300, 0x0041, 0x0308, 0x0304, 0x01DF, 0x0061, 0x0308,
+	0x0304, 0x0041, 0x0307, 0x0304, 0x01E1, 0x0061, 0x0307, 0x0304,
+	0x00C6, 0x0304, 0x01E3, 0x00E6, 0x0304, 0x01E5, 0x0047, 0x030C,
+	0x01E7, 0x0067, 0x030C, 0x004B, 0x030C, 0x01E9, 0x006B, 0x030C,
+	0x004F, 0x0328, 0x01EB, 0x006F, 0x0328, 0x004F, 0x0328, 0x0304,
+	0x01ED, 0x006F, 0x0328, 0x0304, 0x01B7, 0x030C, 0x01EF, 0x0292,
+	0x030C, 0x006A, 0x030C, 0x006A, 0x030C, 0x01F3, 0x01F3, 0x0047,
+	0x0301, 0x01F5, 0x0067, 0x0301, 0x0195, 0x01BF, 0x004E, 0x0300,
+	0x01F9, 0x006E, 0x0300, 0x0041, 0x030A, 0x0301, 0x01FB, 0x0061,
+	0x030A, 0x0301, 0x00C6, 0x0301, 0x01FD, 0x00E6, 0x0301, 0x00D8,
+	0x0301, 0x01FF, 0x00F8, 0x0301, 0x0041, 0x030F, 0x0201, 0x0061,
+	0x030F, 0x0041, 0x0311, 0x0203, 0x0061, 0x0311, 0x0045, 0x030F,
+	0x0205, 0x0065, 0x030F, 0x0045, 0x0311, 0x0207, 0x0065, 0x0311,
+	0x0049, 0x030F, 0x0209, 0x0069, 0x030F, 0x0049, 0x0311, 0x020B,
+	0x0069, 0x0311, 0x004F, 0x030F, 0x020D, 0x006F, 0x030F, 0x004F,
+	0x0311, 0x020F, 0x006F, 0x0311, 0x0052, 0x030F, 0x0211, 0x0072,
+	0x030F, 0x0052, 0x0311, 0x0213, 0x0072, 0x0311, 0x0055, 0x030F,
+	0x0215, 0x0075, 0x030F, 0x0055, 0x0311, 0x0217, 0x0075, 0x0311,
+	0x0053, 0x0326, 0x0219, 0x0073, 0x0326, 0x0054, 0x0326, 0x021B,
+	0x0074, 0x0326, 0x021D, 0x0048, 0x030C, 0x021F, 0x0068, 0x030C,
+	0x019E, 0x0223, 0x0225, 0x0041, 0x0307, 0x0227, 0x0061, 0x0307,
+	0x0045, 0x0327, 0x0229, 0x0065, 0x0327, 0x004F, 0x0308, 0x0304,
+	0x022B, 0x006F, 0x0308, 0x0304, 0x004F, 0x0303, 0x0304, 0x022D,
+	0x006F, 0x0303, 0x0304, 0x004F, 0x0307, 0x022F, 0x006F, 0x0307,
+	0x004F, 0x0307, 0x0304, 0x0231, 0x006F, 0x0307, 0x0304, 0x0059,
+	0x0304, 0x0233, 0x0079, 0x0304, 0x2C65, 0x023C, 0x019A, 0x2C66,
+	0x0242, 0x0180, 0x0289, 0x028C, 0x0247, 0x0249, 0x024B, 0x024D,
+	0x024F, 0x0300, 0x0301, 0x0313, 0x0308, 0x0301, 0x03B9, 0x0371,
+	0x0373, 0x02B9, 0x0377, 0x003B, 0x03F3, 0x00A8, 0x0301, 0x0391,
+	0x0301, 0x03AC, 0x00B7, 0x0395, 0x0301, 0x03AD, 0x0397, 0x0301,
+	0x03AE, 0x0399, 0x0301, 0x03AF, 0x039F, 0x0301, 0x03CC, 0x03A5,
+	0x0301, 0x03CD, 0x03A9, 0x0301, 0x03CE, 0x03B9, 0x0308, 0x0301,
+	0x03B9, 0x0308, 0x0301, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5,
+	0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD,
+	0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03C6,
+	0x03C7, 0x03C8, 0x03C9, 0x0399, 0x0308, 0x03CA, 0x03A5, 0x0308,
+	0x03CB, 0x03B1, 0x0301, 0x03B5, 0x0301, 0x03B7, 0x0301, 0x03B9,
+	0x0301, 0x03C5, 0x0308, 0x0301, 0x03C5, 0x0308, 0x0301, 0x03C3,
+	0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301,
+	0x03C9, 0x0301, 0x03D7, 0x03B2, 0x03B8, 0x03D2, 0x0301, 0x03D2,
+	0x0308, 0x03C6, 0x03C0, 0x03D9, 0x03DB, 0x03DD, 0x03DF, 0x03E1,
+	0x03E3, 0x03E5, 0x03E7, 0x03E9, 0x03EB, 0x03ED, 0x03EF, 0x03BA,
+	0x03C1, 0x03B8, 0x03B5, 0x03F8, 0x03F2, 0x03FB, 0x037B, 0x037C,
+	0x037D, 0x0415, 0x0300, 0x0450, 0x0415, 0x0308, 0x0451, 0x0452,
+	0x0413, 0x0301, 0x0453, 0x0454, 0x0455, 0x0456, 0x0406, 0x0308,
+	0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x041A, 0x0301, 0x045C,
+	0x0418, 0x0300, 0x045D, 0x0423, 0x0306, 0x045E, 0x045F, 0x0430,
+	0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438,
+	0x0418, 0x0306, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+	0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446,
+	0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E,
+	0x044F, 0x0438, 0x0306, 0x0435, 0x0300, 0x0435, 0x0308, 0x0433,
+	0x0301, 0x0456, 0x0308, 0x043A, 0x0301, 0x0438, 0x0300, 0x0443,
+	0x0306, 0x0461, 0x0463, 0x0465, 0x0467, 0x0469, 0x046B, 0x046D,
+	0x046F, 0x0471, 0x0473, 0x0475, 0x0474, 0x030F, 0x0477, 0x0475,
+	0x030F, 0x0479, 0x047B, 0x047D, 0x047F, 0x0481, 0x048B, 0x048D,
+	0x048F, 0x0491, 0x0493, 0x0495, 0x0497, 0x0499, 0x049B, 0x049D,
+	0x049F, 0x04A1, 0x04A3, 0x04A5, 0x04A7, 0x04A9, 0x04AB, 0x04AD,
+	0x04AF, 0x04B1, 0x04B3, 0x04B5, 0x04B7, 0x04B9, 0x04BB, 0x04BD,
+	0x04BF, 0x04CF, 0x0416, 0x0306, 0x04C2, 0x0436, 0x0306, 0x04C4,
+	0x04C6, 0x04C8, 0x04CA, 0x04CC, 0x04CE, 0x0410, 0x0306, 0x04D1,
+	0x0430, 0x0306, 0x0410, 0x0308, 0x04D3, 0x0430, 0x0308, 0x04D5,
+	0x0415, 0x0306, 0x04D7, 0x0435, 0x0306, 0x04D9, 0x04D8, 0x0308,
+	0x04DB, 0x04D9, 0x0308, 0x0416, 0x0308, 0x04DD, 0x0436, 0x0308,
+	0x0417, 0x0308, 0x04DF, 0x0437, 0x0308, 0x04E1, 0x0418, 0x0304,
+	0x04E3, 0x0438, 0x0304, 0x0418, 0x0308, 0x04E5, 0x0438, 0x0308,
+	0x041E, 0x0308, 0x04E7, 0x043E, 0x0308, 0x04E9, 0x04E8, 0x0308,
+	0x04EB, 0x04E9, 0x0308, 0x042D, 0x0308, 0x04ED, 0x044D, 0x0308,
+	0x0423, 0x0304, 0x04EF, 0x0443, 0x0304, 0x0423, 0x0308, 0x04F1,
+	0x0443, 0x0308, 0x0423, 0x030B, 0x04F3, 0x0443, 0x030B, 0x0427,
+	0x0308, 0x04F5, 0x0447, 0x0308, 0x04F7, 0x042B, 0x0308, 0x04F9,
+	0x044B, 0x0308, 0x04FB, 0x04FD, 0x04FF, 0x0501, 0x0503, 0x0505,
+	0x0507, 0x0509, 0x050B, 0x050D, 0x050F, 0x0511, 0x0513, 0x0515,
+	0x0517, 0x0519, 0x051B, 0x051D, 0x051F, 0x0521, 0x0523, 0x0525,
+	0x0527, 0x0529, 0x052B, 0x052D, 0x052F, 0x0561, 0x0562, 0x0563,
+	0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569, 0x056A, 0x056B,
+	0x056C, 0x056D, 0x056E, 0x056F, 0x0570, 0x0571, 0x0572, 0x0573,
+	0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579, 0x057A, 0x057B,
+	0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581, 0x0582, 0x0583,
+	0x0584, 0x0585, 0x0586, 0x0565, 0x0582, 0x0627, 0x0653, 0x0627,
+	0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A, 0x0654, 0x06D5,
+	0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928, 0x093C, 0x0930,
+	0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C, 0x0917,
+	0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922, 0x093C, 0x092B,
+	0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7, 0x09A1,
+	0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C, 0x0A38,
+	0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C, 0x0A2B,
+	0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57, 0x0B21,
+	0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE, 0x0BC7,
+	0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5, 0x0CC6,
+	0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2, 0x0CD5,
+	0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9, 0x0DCA,
+	0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF, 0x0F42,
+	0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56, 0x0FB7, 0x0F5B,
+	0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71, 0x0F74, 0x0FB2,
+	0x0F80, 0x0FB3, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7, 0x0F9C,
+	0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7, 0x0F90,
+	0x0FB5, 0x1025, 0x102E, 0x2D00, 0x2D01, 0x2D02, 0x2D03, 0x2D04,
+	0x2D05, 0x2D06, 0x2D07, 0x2D08, 0x2D09, 0x2D0A, 0x2D0B, 0x2D0C,
+	0x2D0D, 0x2D0E, 0x2D0F, 0x2D10, 0x2D11, 0x2D12, 0x2D13, 0x2D14,
+	0x2D15, 0x2D16, 0x2D17, 0x2D18, 0x2D19, 0x2D1A, 0x2D1B, 0x2D1C,
+	0x2D1D, 0x2D1E, 0x2D1F, 0x2D20, 0x2D21, 0x2D22, 0x2D23, 0x2D24,
+	0x2D25, 0x2D27, 0x2D2D, 0x13F0, 0x13F1, 0x13F2, 0x13F3, 0x13F4,
+	0x13F5, 0x1B05, 0x1B35, 0x1B07, 0x1B35, 0x1B09, 0x1B35, 0x1B0B,
+	0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35, 0x1B3A, 0x1B35, 0x1B3C,
+	0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0x0432,
+	0x0434, 0x043E, 0x0441, 0x0442, 0x0442, 0x044A, 0x0463, 0xA64B,
+	0x10D0, 0x10D1, 0x10D2, 0x10D3, 0x10D4, 0x10D5, 0x10D6, 0x10D7,
+	0x10D8, 0x10D9, 0x10DA, 0x10DB, 0x10DC, 0x10DD, 0x10DE, 0x10DF,
+	0x10E0, 0x10E1, 0x10E2, 0x10E3, 0x10E4, 0x10E5, 0x10E6, 0x10E7,
+	0x10E8, 0x10E9, 0x10EA, 0x10EB, 0x10EC, 0x10ED, 0x10EE, 0x10EF,
+	0x10F0, 0x10F1, 0x10F2, 0x10F3, 0x10F4, 0x10F5, 0x10F6, 0x10F7,
+	0x10F8, 0x10F9, 0x10FA, 0x10FD, 0x10FE, 0x10FF, 0x0041, 0x0325,
+	0x1E01, 0x0061, 0x0325, 0x0042, 0x0307, 0x1E03, 0x0062, 0x0307,
+	0x0042, 0x0323, 0x1E05, 0x0062, 0x0323, 0x0042, 0x0331, 0x1E07,
+	0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x1E09, 0x0063, 0x0327,
+	0x0301, 0x0044, 0x0307, 0x1E0B, 0x0064, 0x0307, 0x0044, 0x0323,
+	0x1E0D, 0x0064, 0x0323, 0x0044, 0x0331, 0x1E0F, 0x0064, 0x0331,
+	0x0044, 0x0327, 0x1E11, 0x0064, 0x0327, 0x0044, 0x032D, 0x1E13,
+	0x0064, 0x032D, 0x0045, 0x0304, 0x0300, 0x1E15, 0x0065, 0x0304,
+	0x0300, 0x0045, 0x0304, 0x0301, 0x1E17, 0x0065, 0x0304, 0x0301,
+	0x0045, 0x032D, 0x1E19, 0x0065, 0x032D, 0x0045, 0x0330, 0x1E1B,
+	0x0065, 0x0330, 0x0045, 0x0327, 0x0306, 0x1E1D, 0x0065, 0x0327,
+	0x0306, 0x0046, 0x0307, 0x1E1F, 0x0066, 0x0307, 0x0047, 0x0304,
+	0x1E21, 0x0067, 0x0304, 0x0048, 0x0307, 0x1E23, 0x0068, 0x0307,
+	0x0048, 0x0323, 0x1E25, 0x0068, 0x0323, 0x0048, 0x0308, 0x1E27,
+	0x0068, 0x0308, 0x0048, 0x0327, 0x1E29, 0x0068, 0x0327, 0x0048,
+	0x032E, 0x1E2B, 0x0068, 0x032E, 0x0049, 0x0330, 0x1E2D, 0x0069,
+	0x0330, 0x0049, 0x0308, 0x0301, 0x1E2F, 0x0069, 0x0308, 0x0301,
+	0x004B, 0x0301, 0x1E31, 0x006B, 0x0301, 0x004B, 0x0323, 0x1E33,
+	0x006B, 0x0323, 0x004B, 0x0331, 0x1E35, 0x006B, 0x0331, 0x004C,
+	0x0323, 0x1E37, 0x006C, 0x0323, 0x004C, 0x0323, 0x0304, 0x1E39,
+	0x006C, 0x0323, 0x0304, 0x004C, 0x0331, 0x1E3B, 0x006C, 0x0331,
+	0x004C, 0x032D, 0x1E3D, 0x006C, 0x032D, 0x004D, 0x0301, 0x1E3F,
+	0x006D, 0x0301, 0x004D, 0x0307, 0x1E41, 0x006D, 0x0307, 0x004D,
+	0x0323, 0x1E43, 0x006D, 0x0323, 0x004E, 0x0307, 0x1E45, 0x006E,
+	0x0307, 0x004E, 0x0323, 0x1E47, 0x006E, 0x0323, 0x004E, 0x0331,
+	0x1E49, 0x006E, 0x0331, 0x004E, 0x032D, 0x1E4B, 0x006E, 0x032D,
+	0x004F, 0x0303, 0x0301, 0x1E4D, 0x006F, 0x0303, 0x0301, 0x004F,
+	0x0303, 0x0308, 0x1E4F, 0x006F, 0x0303, 0x0308, 0x004F, 0x0304,
+	0x0300, 0x1E51, 0x006F, 0x0304, 0x0300, 0x004F, 0x0304, 0x0301,
+	0x1E53, 0x006F, 0x0304, 0x0301, 0x0050, 0x0301, 0x1E55, 0x0070,
+	0x0301, 0x0050, 0x0307, 0x1E57, 0x0070, 0x0307, 0x0052, 0x0307,
+	0x1E59, 0x0072, 0x0307, 0x0052, 0x0323, 0x1E5B, 0x0072, 0x0323,
+	0x0052, 0x0323, 0x0304, 0x1E5D, 0x0072, 0x0323, 0x0304, 0x0052,
+	0x0331, 0x1E5F, 0x0072, 0x0331, 0x0053, 0x0307, 0x1E61, 0x0073,
+	0x0307, 0x0053, 0x0323, 0x1E63, 0x0073, 0x0323, 0x0053, 0x0301,
+	0x0307, 0x1E65, 0x0073, 0x0301, 0x0307, 0x0053, 0x030C, 0x0307,
+	0x1E67, 0x0073, 0x030C, 0x0307, 0x0053, 0x0323, 0x0307, 0x1E69,
+	0x0073, 0x0323, 0x0307, 0x0054, 0x0307, 0x1E6B, 0x0074, 0x0307,
+	0x0054, 0x0323, 0x1E6D, 0x0074, 0x0323, 0x0054, 0x0331, 0x1E6F,
+	0x0074, 0x0331, 0x0054, 0x032D, 0x1E71, 0x0074, 0x032D, 0x0055,
+	0x0324, 0x1E73, 0x0075, 0x0324, 0x0055, 0x0330, 0x1E75, 0x0075,
+	0x0330, 0x0055, 0x032D, 0x1E77, 0x0075, 0x032D, 0x0055, 0x0303,
+	0x0301, 0x1E79, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308,
+	0x1E7B, 0x0075, 0x0304, 0x0308, 0x0056, 0x0303, 0x1E7D, 0x0076,
+	0x0303, 0x0056, 0x0323, 0x1E7F, 0x0076, 0x0323, 0x0057, 0x0300,
+	0x1E81, 0x0077, 0x0300, 0x0057, 0x0301, 0x1E83, 0x0077, 0x0301,
+	0x0057, 0x0308, 0x1E85, 0x0077, 0x0308, 0x0057, 0x0307, 0x1E87,
+	0x0077, 0x0307, 0x0057, 0x0323, 0x1E89, 0x0077, 0x0323, 0x0058,
+	0x0307, 0x1E8B, 0x0078, 0x0307, 0x0058, 0x0308, 0x1E8D, 0x0078,
+	0x0308, 0x0059, 0x0307, 0x1E8F, 0x0079, 0x0307, 0x005A, 0x0302,
+	0x1E91, 0x007A, 0x0302, 0x005A, 0x0323, 0x1E93, 0x007A, 0x0323,
+	0x005A, 0x0331, 0x1E95, 0x007A, 0x0331, 0x0068, 0x0331, 0x0068,
+	0x0331, 0x0074, 0x0308, 0x0074, 0x0308, 0x0077, 0x030A, 0x0077,
+	0x030A, 0x0079, 0x030A, 0x0079, 0x030A, 0x0061, 0x02BE, 0x017F,
+	0x0307, 0x1E61, 0x0073, 0x0073, 0x0041, 0x0323, 0x1EA1, 0x0061,
+	0x0323, 0x0041, 0x0309, 0x1EA3, 0x0061, 0x0309, 0x0041, 0x0302,
+	0x0301, 0x1EA5, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302, 0x0300,
+	0x1EA7, 0x0061, 0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x1EA9,
+	0x0061, 0x0302, 0x0309, 0x0041, 0x0302, 0x0303, 0x1EAB, 0x0061,
+	0x0302, 0x0303, 0x0041, 0x0323, 0x0302, 0x1EAD, 0x0061, 0x0323,
+	0x0302, 0x0041, 0x0306, 0x0301, 0x1EAF, 0x0061, 0x0306, 0x0301,
+	0x0041, 0x0306, 0x0300, 0x1EB1, 0x0061, 0x0306, 0x0300, 0x0041,
+	0x0306, 0x0309, 0x1EB3, 0x0061, 0x0306, 0x0309, 0x0041, 0x0306,
+	0x0303, 0x1EB5, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323, 0x0306,
+	0x1EB7, 0x0061, 0x0323, 0x0306, 0x0045, 0x0323, 0x1EB9, 0x0065,
+	0x0323, 0x0045, 0x0309, 0x1EBB, 0x0065, 0x0309, 0x0045, 0x0303,
+	0x1EBD, 0x0065, 0x0303, 0x0045, 0x0302, 0x0301, 0x1EBF, 0x0065,
+	0x0302, 0x0301, 0x0045, 0x0302, 0x0300, 0x1EC1, 0x0065, 0x0302,
+	0x0300, 0x0045, 0x0302, 0x0309, 0x1EC3, 0x0065, 0x0302, 0x0309,
+	0x0045, 0x0302, 0x0303, 0x1EC5, 0x0065, 0x0302, 0x0303, 0x0045,
+	0x0323, 0x0302, 0x1EC7, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309,
+	0x1EC9, 0x0069, 0x0309, 0x0049, 0x0323, 0x1ECB, 0x0069, 0x0323,
+	0x004F, 0x0323, 0x1ECD, 0x006F, 0x0323, 0x004F, 0x0309, 0x1ECF,
+	0x006F, 0x0309, 0x004F, 0x0302, 0x0301, 0x1ED1, 0x006F, 0x0302,
+	0x0301, 0x004F, 0x0302, 0x0300, 0x1ED3, 0x006F, 0x0302, 0x0300,
+	0x004F, 0x0302, 0x0309, 0x1ED5, 0x006F, 0x0302, 0x0309, 0x004F,
+	0x0302, 0x0303, 0x1ED7, 0x006F, 0x0302, 0x0303, 0x004F, 0x0323,
+	0x0302, 0x1ED9, 0x006F, 0x0323, 0x0302, 0x004F, 0x031B, 0x0301,
+	0x1EDB, 0x006F, 0x031B, 0x0301, 0x004F, 0x031B, 0x0300, 0x1EDD,
+	0x006F, 0x031B, 0x0300, 0x004F, 0x031B, 0x0309, 0x1EDF, 0x006F,
+	0x031B, 0x0309, 0x004F, 0x031B, 0x0303, 0x1EE1, 0x006F, 0x031B,
+	0x0303, 0x004F, 0x031B, 0x0323, 0x1EE3, 0x006F, 0x031B, 0x0323,
+	0x0055, 0x0323, 0x1EE5, 0x0075, 0x0323, 0x0055, 0x0309, 0x1EE7,
+	0x0075, 0x0309, 0x0055, 0x031B, 0x0301, 0x1EE9, 0x0075, 0x031B,
+	0x0301, 0x0055, 0x031B, 0x0300, 0x1EEB, 0x0075, 0x031B, 0x0300,
+	0x0055, 0x031B, 0x0309, 0x1EED, 0x0075, 0x031B, 0x0309, 0x0055,
+	0x031B, 0x0303, 0x1EEF, 0x0075, 0x031B, 0x0303, 0x0055, 0x031B,
+	0x0323, 0x1EF1, 0x0075, 0x031B, 0x0323, 0x0059, 0x0300, 0x1EF3,
+	0x0079, 0x0300, 0x0059, 0x0323, 0x1EF5, 0x0079, 0x0323, 0x0059,
+	0x0309, 0x1EF7, 0x0079, 0x0309, 0x0059, 0x0303, 0x1EF9, 0x0079,
+	0x0303, 0x1EFB, 0x1EFD, 0x1EFF, 0x03B1, 0x0313, 0x03B1, 0x0314,
+	0x03B1, 0x0313, 0x0300, 0x03B1, 0x0314, 0x0300, 0x03B1, 0x0313,
+	0x0301, 0x03B1, 0x0314, 0x0301, 0x03B1, 0x0313, 0x0342, 0x03B1,
+	0x0314, 0x0342, 0x0391, 0x0313, 0x1F00, 0x0391, 0x0314, 0x1F01,
+	0x0391, 0x0313, 0x0300, 0x1F02, 0x0391, 0x0314, 0x0300, 0x1F03,
+	0x0391, 0x0313, 0x0301, 0x1F04, 0x0391, 0x0314, 0x0301, 0x1F05,
+	0x0391, 0x0313, 0x0342, 0x1F06, 0x0391, 0x0314, 0x0342, 0x1F07,
+	0x03B5, 0x0313, 0x03B5, 0x0314, 0x03B5, 0x0313, 0x0300, 0x03B5,
+	0x0314, 0x0300, 0x03B5, 0x0313, 0x0301, 0x03B5, 0x0314, 0x0301,
+	0x0395, 0x0313, 0x1F10, 0x0395, 0x0314, 0x1F11, 0x0395, 0x0313,
+	0x0300, 0x1F12, 0x0395, 0x0314, 0x0300, 0x1F13, 0x0395, 0x0313,
+	0x0301, 0x1F14, 0x0395, 0x0314, 0x0301, 0x1F15, 0x03B7, 0x0313,
+	0x03B7, 0x0314, 0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300,
+	0x03B7, 0x0313, 0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313,
+	0x0342, 0x03B7, 0x0314, 0x0342, 0x0397, 0x0313, 0x1F20, 0x0397,
+	0x0314, 0x1F21, 0x0397, 0x0313, 0x0300, 0x1F22, 0x0397, 0x0314,
+	0x0300, 0x1F23, 0x0397, 0x0313, 0x0301, 0x1F24, 0x0397, 0x0314,
+	0x0301, 0x1F25, 0x0397, 0x0313, 0x0342, 0x1F26, 0x0397, 0x0314,
+	0x0342, 0x1F27, 0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313,
+	0x0300, 0x03B9, 0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9,
+	0x0314, 0x0301, 0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342,
+	0x0399, 0x0313, 0x1F30, 0x0399, 0x0314, 0x1F31, 0x0399, 0x0313,
+	0x0300, 0x1F32, 0x0399, 0x0314, 0x0300, 0x1F33, 0x0399, 0x0313,
+	0x0301, 0x1F34, 0x0399, 0x0314, 0x0301, 0x1F35, 0x0399, 0x0313,
+	0x0342, 0x1F36, 0x0399, 0x0314, 0x0342, 0x1F37, 0x03BF, 0x0313,
+	0x03BF, 0x0314, 0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300,
+	0x03BF, 0x0313, 0x0301, 0x03BF, 0x0314, 0x0301, 0x039F, 0x0313,
+	0x1F40, 0x039F, 0x0314, 0x1F41, 0x039F, 0x0313, 0x0300, 0x1F42,
+	0x039F, 0x0314, 0x0300, 0x1F43, 0x039F, 0x0313, 0x0301, 0x1F44,
+	0x039F, 0x0314, 0x0301, 0x1F45, 0x03C5, 0x0313, 0x03C5, 0x0313,
+	0x03C5, 0x0314, 0x03C5, 0x0313, 0x0300, 0x03C5, 0x0313, 0x0300,
+	0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313, 0x0301, 0x03C5, 0x0313,
+	0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5,
+	0x0313, 0x0342, 0x03C5, 0x0314, 0x0342, 0x03A5, 0x0314, 0x1F51,
+	0x03A5, 0x0314, 0x0300, 0x1F53, 0x03A5, 0x0314, 0x0301, 0x1F55,
+	0x03A5, 0x0314, 0x0342, 0x1F57, 0x03C9, 0x0313, 0x03C9, 0x0314,
+	0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9, 0x0313,
+	0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342, 0x03C9,
+	0x0314, 0x0342, 0x03A9, 0x0313, 0x1F60, 0x03A9, 0x0314, 0x1F61,
+	0x03A9, 0x0313, 0x0300, 0x1F62, 0x03A9, 0x0314, 0x0300, 0x1F63,
+	0x03A9, 0x0313, 0x0301, 0x1F64, 0x03A9, 0x0314, 0x0301, 0x1F65,
+	0x03A9, 0x0313, 0x0342, 0x1F66, 0x03A9, 0x0314, 0x0342, 0x1F67,
+	0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B5, 0x0300, 0x03B5, 0x0301,
+	0x03B7, 0x0300, 0x03B7, 0x0301, 0x03B9, 0x0300, 0x03B9, 0x0301,
+	0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C5, 0x0300, 0x03C5, 0x0301,
+	0x03C9, 0x0300, 0x03C9, 0x0301, 0x03B1, 0x0313, 0x0345, 0x1F00,
+	0x03B9, 0x03B1, 0x0314, 0x0345, 0x1F01, 0x03B9, 0x03B1, 0x0313,
+	0x0300, 0x0345, 0x1F02, 0x03B9, 0x03B1, 0x0314, 0x0300, 0x0345,
+	0x1F03, 0x03B9, 0x03B1, 0x0313, 0x0301, 0x0345, 0x1F04, 0x03B9,
+	0x03B1, 0x0314, 0x0301, 0x0345, 0x1F05, 0x03B9, 0x03B1, 0x0313,
+	0x0342, 0x0345, 0x1F06, 0x03B9, 0x03B1, 0x0314, 0x0342, 0x0345,
+	0x1F07, 0x03B9, 0x0391, 0x0313, 0x0345, 0x1F00, 0x03B9, 0x0391,
+	0x0314, 0x0345, 0x1F01, 0x03B9, 0x0391, 0x0313, 0x0300, 0x0345,
+	0x1F02, 0x03B9, 0x0391, 0x0314, 0x0300, 0x0345, 0x1F03, 0x03B9,
+	0x0391, 0x0313, 0x0301, 0x0345, 0x1F04, 0x03B9, 0x0391, 0x0314,
+	0x0301, 0x0345, 0x1F05, 0x03B9, 0x0391, 0x0313, 0x0342, 0x0345,
+	0x1F06, 0x03B9, 0x0391, 0x0314, 0x0342, 0x0345, 0x1F07, 0x03B9,
+	0x03B7, 0x0313, 0x0345, 0x1F20, 0x03B9, 0x03B7, 0x0314, 0x0345,
+	0x1F21, 0x03B9, 0x03B7, 0x0313, 0x0300, 0x0345, 0x1F22, 0x03B9,
+	0x03B7, 0x0314, 0x0300, 0x0345, 0x1F23, 0x03B9, 0x03B7, 0x0313,
+	0x0301, 0x0345, 0x1F24, 0x03B9, 0x03B7, 0x0314, 0x0301, 0x0345,
+	0x1F25, 0x03B9, 0x03B7, 0x0313, 0x0342, 0x0345, 0x1F26, 0x03B9,
+	0x03B7, 0x0314, 0x0342, 0x0345, 0x1F27, 0x03B9, 0x0397, 0x0313,
+	0x0345, 0x1F20, 0x03B9, 0x0397, 0x0314, 0x0345, 0x1F21, 0x03B9,
+	0x0397, 0x0313, 0x0300, 0x0345, 0x1F22, 0x03B9, 0x0397, 0x0314,
+	0x0300, 0x0345, 0x1F23, 0x03B9, 0x0397, 0x0313, 0x0301, 0x0345,
+	0x1F24, 0x03B9, 0x0397, 0x0314, 0x0301, 0x0345, 0x1F25, 0x03B9,
+	0x0397, 0x0313, 0x0342, 0x0345, 0x1F26, 0x03B9, 0x0397, 0x0314,
+	0x0342, 0x0345, 0x1F27, 0x03B9, 0x03C9, 0x0313, 0x0345, 0x1F60,
+	0x03B9, 0x03C9, 0x0314, 0x0345, 0x1F61, 0x03B9, 0x03C9, 0x0313,
+	0x0300, 0x0345, 0x1F62, 0x03B9, 0x03C9, 0x0314, 0x0300, 0x0345,
+	0x1F63, 0x03B9, 0x03C9, 0x0313, 0x0301, 0x0345, 0x1F64, 0x03B9,
+	0x03C9, 0x0314, 0x0301, 0x0345, 0x1F65, 0x03B9, 0x03C9, 0x0313,
+	0x0342, 0x0345, 0x1F66, 0x03B9, 0x03C9, 0x0314, 0x0342, 0x0345,
+	0x1F67, 0x03B9, 0x03A9, 0x0313, 0x0345, 0x1F60, 0x03B9, 0x03A9,
+	0x0314, 0x0345, 0x1F61, 0x03B9, 0x03A9, 0x0313, 0x0300, 0x0345,
+	0x1F62, 0x03B9, 0x03A9, 0x0314, 0x0300, 0x0345, 0x1F63, 0x03B9,
+	0x03A9, 0x0313, 0x0301, 0x0345, 0x1F64, 0x03B9, 0x03A9, 0x0314,
+	0x0301, 0x0345, 0x1F65, 0x03B9, 0x03A9, 0x0313, 0x0342, 0x0345,
+	0x1F66, 0x03B9, 0x03A9, 0x0314, 0x0342, 0x0345, 0x1F67, 0x03B9,
+	0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x0345, 0x1F70,
+	0x03B9, 0x03B1, 0x0345, 0x03B1, 0x03B9, 0x03B1, 0x0301, 0x0345,
+	0x03AC, 0x03B9, 0x03B1, 0x0342, 0x03B1, 0x0342, 0x03B1, 0x0342,
+	0x0345, 0x03B1, 0x0342, 0x03B9, 0x0391, 0x0306, 0x1FB0, 0x0391,
+	0x0304, 0x1FB1, 0x0391, 0x0300, 0x1F70, 0x0391, 0x0301, 0x1F71,
+	0x0391, 0x0345, 0x03B1, 0x03B9, 0x03B9, 0x03B9, 0x00A8, 0x0342,
+	0x03B7, 0x0300, 0x0345, 0x1F74, 0x03B9, 0x03B7, 0x0345, 0x03B7,
+	0x03B9, 0x03B7, 0x0301, 0x0345, 0x03AE, 0x03B9, 0x03B7, 0x0342,
+	0x03B7, 0x0342, 0x03B7, 0x0342, 0x0345, 0x03B7, 0x0342, 0x03B9,
+	0x0395, 0x0300, 0x1F72, 0x0395, 0x0301, 0x1F73, 0x0397, 0x0300,
+	0x1F74, 0x0397, 0x0301, 0x1F75, 0x0397, 0x0345, 0x03B7, 0x03B9,
+	0x1FBF, 0x0300, 0x1FBF, 0x0301, 0x1FBF, 0x0342, 0x03B9, 0x0306,
+	0x03B9, 0x0304, 0x03B9, 0x0308, 0x0300, 0x03B9, 0x0308, 0x0300,
+	0x03B9, 0x0308, 0x0301, 0x03B9, 0x0308, 0x0301, 0x03B9, 0x0342,
+	0x03B9, 0x0342, 0x03B9, 0x0308, 0x0342, 0x03B9, 0x0308, 0x0342,
+	0x0399, 0x0306, 0x1FD0, 0x0399, 0x0304, 0x1FD1, 0x0399, 0x0300,
+	0x1F76, 0x0399, 0x0301, 0x1F77, 0x1FFE, 0x0300, 0x1FFE, 0x0301,
+	0x1FFE, 0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308,
+	0x0300, 0x03C5, 0x0308, 0x0300, 0x03C5, 0x0308, 0x0301, 0x03C5,
+	0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1, 0x0313, 0x03C1, 0x0314,
+	0x03C5, 0x0342, 0x03C5, 0x0342, 0x03C5, 0x0308, 0x0342, 0x03C5,
+	0x0308, 0x0342, 0x03A5, 0x0306, 0x1FE0, 0x03A5, 0x0304, 0x1FE1,
+	0x03A5, 0x0300, 0x1F7A, 0x03A5, 0x0301, 0x1F7B, 0x03A1, 0x0314,
+	0x1FE5, 0x00A8, 0x0300, 0x00A8, 0x0301, 0x0060, 0x03C9, 0x0300,
+	0x0345, 0x1F7C, 0x03B9, 0x03C9, 0x0345, 0x03C9, 0x03B9, 0x03C9,
+	0x0301, 0x0345, 0x03CE, 0x03B9, 0x03C9, 0x0342, 0x03C9, 0x0342,
+	0x03C9, 0x0342, 0x0345, 0x03C9, 0x0342, 0x03B9, 0x039F, 0x0300,
+	0x1F78, 0x039F, 0x0301, 0x1F79, 0x03A9, 0x0300, 0x1F7C, 0x03A9,
+	0x0301, 0x1F7D, 0x03A9, 0x0345, 0x03C9, 0x03B9, 0x00B4, 0x2002,
+	0x2003, 0x03A9, 0x03C9, 0x004B, 0x006B, 0x0041, 0x030A, 0x00E5,
+	0x214E, 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176,
+	0x2177, 0x2178, 0x2179, 0x217A, 0x217B, 0x217C, 0x217D, 0x217E,
+	0x217F, 0x2184, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338,
+	0x21D0, 0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338,
+	0x2208, 0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338,
+	0x223C, 0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338,
+	0x003D, 0x0338, 0x2261, 0x0338, 0x224D, 0x0338, 0x003C, 0x0338,
+	0x003E, 0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338,
+	0x2273, 0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227A, 0x0338,
+	0x227B, 0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338,
+	0x2287, 0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338, 0x22A9, 0x0338,
+	0x22AB, 0x0338, 0x227C, 0x0338, 0x227D, 0x0338, 0x2291, 0x0338,
+	0x2292, 0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338, 0x22B4, 0x0338,
+	0x22B5, 0x0338, 0x3008, 0x3009, 0x24D0, 0x24D1, 0x24D2, 0x24D3,
+	0x24D4, 0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9, 0x24DA, 0x24DB,
+	0x24DC, 0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3,
+	0x24E4, 0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9, 0x2ADD, 0x0338,
+	0x2C30, 0x2C31, 0x2C32, 0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37,
+	0x2C38, 0x2C39, 0x2C3A, 0x2C3B, 0x2C3C, 0x2C3D, 0x2C3E, 0x2C3F,
+	0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44, 0x2C45, 0x2C46, 0x2C47,
+	0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F,
+	0x2C50, 0x2C51, 0x2C52, 0x2C53, 0x2C54, 0x2C55, 0x2C56, 0x2C57,
+	0x2C58, 0x2C59, 0x2C5A, 0x2C5B, 0x2C5C, 0x2C5D, 0x2C5E, 0x2C5F,
+	0x2C61, 0x026B, 0x1D7D, 0x027D, 0x2C68, 0x2C6A, 0x2C6C, 0x0251,
+	0x0271, 0x0250, 0x0252, 0x2C73, 0x2C76, 0x023F, 0x0240, 0x2C81,
+	0x2C83, 0x2C85, 0x2C87, 0x2C89, 0x2C8B, 0x2C8D, 0x2C8F, 0x2C91,
+	0x2C93, 0x2C95, 0x2C97, 0x2C99, 0x2C9B, 0x2C9D, 0x2C9F, 0x2CA1,
+	0x2CA3, 0x2CA5, 0x2CA7, 0x2CA9, 0x2CAB, 0x2CAD, 0x2CAF, 0x2CB1,
+	0x2CB3, 0x2CB5, 0x2CB7, 0x2CB9, 0x2CBB, 0x2CBD, 0x2CBF, 0x2CC1,
+	0x2CC3, 0x2CC5, 0x2CC7, 0x2CC9, 0x2CCB, 0x2CCD, 0x2CCF, 0x2CD1,
+	0x2CD3, 0x2CD5, 0x2CD7, 0x2CD9, 0x2CDB, 0x2CDD, 0x2CDF, 0x2CE1,
+	0x2CE3, 0x2CEC, 0x2CEE, 0x2CF3, 0x304B, 0x3099, 0x304D, 0x3099,
+	0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099,
+	0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D, 0x3099,
+	0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099,
+	0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099,
+	0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099,
+	0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099,
+	0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099,
+	0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099,
+	0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099,
+	0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099,
+	0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A,
+	0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A,
+	0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099,
+	0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099,
+	0xA641, 0xA643, 0xA645, 0xA647, 0xA649, 0xA64B, 0xA64D, 0xA64F,
+	0xA651, 0xA653, 0xA655, 0xA657, 0xA659, 0xA65B, 0xA65D, 0xA65F,
+	0xA661, 0xA663, 0xA665, 0xA667, 0xA669, 0xA66B, 0xA66D, 0xA681,
+	0xA683, 0xA685, 0xA687, 0xA689, 0xA68B, 0xA68D, 0xA68F, 0xA691,
+	0xA693, 0xA695, 0xA697, 0xA699, 0xA69B, 0xA723, 0xA725, 0xA727,
+	0xA729, 0xA72B, 0xA72D, 0xA72F, 0xA733, 0xA735, 0xA737, 0xA739,
+	0xA73B, 0xA73D, 0xA73F, 0xA741, 0xA743, 0xA745, 0xA747, 0xA749,
+	0xA74B, 0xA74D, 0xA74F, 0xA751, 0xA753, 0xA755, 0xA757, 0xA759,
+	0xA75B, 0xA75D, 0xA75F, 0xA761, 0xA763, 0xA765, 0xA767, 0xA769,
+	0xA76B, 0xA76D, 0xA76F, 0xA77A, 0xA77C, 0x1D79, 0xA77F, 0xA781,
+	0xA783, 0xA785, 0xA787, 0xA78C, 0x0265, 0xA791, 0xA793, 0xA797,
+	0xA799, 0xA79B, 0xA79D, 0xA79F, 0xA7A1, 0xA7A3, 0xA7A5, 0xA7A7,
+	0xA7A9, 0x0266, 0x025C, 0x0261, 0x026C, 0x026A, 0x029E, 0x0287,
+	0x029D, 0xAB53, 0xA7B5, 0xA7B7, 0xA7B9, 0xA7BB, 0xA7BD, 0xA7BF,
+	0xA7C1, 0xA7C3, 0xA794, 0x0282, 0x1D8E, 0xA7C8, 0xA7CA, 0xA7D1,
+	0xA7D7, 0xA7D9, 0xA7F6, 0x13A0, 0x13A1, 0x13A2, 0x13A3, 0x13A4,
+	0x13A5, 0x13A6, 0x13A7, 0x13A8, 0x13A9, 0x13AA, 0x13AB, 0x13AC,
+	0x13AD, 0x13AE, 0x13AF, 0x13B0, 0x13B1, 0x13B2, 0x13B3, 0x13B4,
+	0x13B5, 0x13B6, 0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x13BB, 0x13BC,
+	0x13BD, 0x13BE, 0x13BF, 0x13C0, 0x13C1, 0x13C2, 0x13C3, 0x13C4,
+	0x13C5, 0x13C6, 0x13C7, 0x13C8, 0x13C9, 0x13CA, 0x13CB, 0x13CC,
+	0x13CD, 0x13CE, 0x13CF, 0x13D0, 0x13D1, 0x13D2, 0x13D3, 0x13D4,
+	0x13D5, 0x13D6, 0x13D7, 0x13D8, 0x13D9, 0x13DA, 0x13DB, 0x13DC,
+	0x13DD, 0x13DE, 0x13DF, 0x13E0, 0x13E1, 0x13E2, 0x13E3, 0x13E4,
+	0x13E5, 0x13E6, 0x13E7, 0x13E8, 0x13E9, 0x13EA, 0x13EB, 0x13EC,
+	0x13ED, 0x13EE, 0x13EF, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1,
+	0x4E32, 0x53E5, 0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948,
+	0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02,
+	0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375,
+	0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964,
+	0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE,
+	0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001,
+	0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F,
+	0x7DA0, 0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60,
+	0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13,
+	0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC,
+	0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02,
+	0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB,
+	0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E,
+	0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5,
+	0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F,
+	0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE,
+	0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77,
+	0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489,
+	0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217,
+	0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B,
+	0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C,
+	0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818,
+	0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE,
+	0x5C3F, 0x6599, 0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D,
+	0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409,
+	0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B,
+	0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686,
+	0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406,
+	0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA,
+	0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797,
+	0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58,
+	0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85,
+	0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140,
+	0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E,
+	0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038,
+	0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE,
+	0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668,
+	0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2,
+	0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E,
+	0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956,
+	0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09,
+	0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910,
+	0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3,
+	0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168,
+	0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599,
+	0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2,
+	0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160,
+	0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717,
+	0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22,
+	0x701E, 0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506,
+	0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740,
+	0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005,
+	0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8,
+	0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38,
+	0x9072, 0x9199, 0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF,
+	0x980B, 0x983B, 0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D,
+	0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x0066,
+	0x0066, 0x0066, 0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x0069,
+	0x0066, 0x0066, 0x006C, 0x0073, 0x0074, 0x0073, 0x0074, 0x0574,
+	0x0576, 0x0574, 0x0565, 0x0574, 0x056B, 0x057E, 0x0576, 0x0574,
+	0x056D, 0x05D9, 0x05B4, 0x05F2, 0x05B7, 0x05E9, 0x05C1, 0x05E9,
+	0x05C2, 0x05E9, 0x05BC, 0x05C1, 0x05E9, 0x05BC, 0x05C2, 0x05D0,
+	0x05B7, 0x05D0, 0x05B8, 0x05D0, 0x05BC, 0x05D1, 0x05BC, 0x05D2,
+	0x05BC, 0x05D3, 0x05BC, 0x05D4, 0x05BC, 0x05D5, 0x05BC, 0x05D6,
+	0x05BC, 0x05D8, 0x05BC, 0x05D9, 0x05BC, 0x05DA, 0x05BC, 0x05DB,
+	0x05BC, 0x05DC, 0x05BC, 0x05DE, 0x05BC, 0x05E0, 0x05BC, 0x05E1,
+	0x05BC, 0x05E3, 0x05BC, 0x05E4, 0x05BC, 0x05E6, 0x05BC, 0x05E7,
+	0x05BC, 0x05E8, 0x05BC, 0x05E9, 0x05BC, 0x05EA, 0x05BC, 0x05D5,
+	0x05B9, 0x05D1, 0x05BF, 0x05DB, 0x05BF, 0x05E4, 0x05BF, 0xFF41,
+	0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49,
+	0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51,
+	0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59,
+	0xFF5A, 0x10428, 0x10429, 0x1042A, 0x1042B, 0x1042C, 0x1042D, 0x1042E,
+	0x1042F, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435, 0x10436,
+	0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C, 0x1043D, 0x1043E,
+	0x1043F, 0x10440, 0x10441, 0x10442, 0x10443, 0x10444, 0x10445, 0x10446,
+	0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D, 0x1044E,
+	0x1044F, 0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD, 0x104DE,
+	0x104DF, 0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4, 0x104E5, 0x104E6,
+	0x104E7, 0x104E8, 0x104E9, 0x104EA, 0x104EB, 0x104EC, 0x104ED, 0x104EE,
+	0x104EF, 0x104F0, 0x104F1, 0x104F2, 0x104F3, 0x104F4, 0x104F5, 0x104F6,
+	0x104F7, 0x104F8, 0x104F9, 0x104FA, 0x104FB, 0x10597, 0x10598, 0x10599,
+	0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E, 0x1059F, 0x105A0, 0x105A1,
+	0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7, 0x105A8, 0x105A9, 0x105AA,
+	0x105AB, 0x105AC, 0x105AD, 0x105AE, 0x105AF, 0x105B0, 0x105B1, 0x105B3,
+	0x105B4, 0x105B5, 0x105B6, 0x105B7, 0x105B8, 0x105B9, 0x105BB, 0x105BC,
+	0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6, 0x10CC7,
+	0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE, 0x10CCF,
+	0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6, 0x10CD7,
+	0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF,
+	0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4, 0x10CE5, 0x10CE6, 0x10CE7,
+	0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE, 0x10CEF,
+	0x10CF0, 0x10CF1, 0x10CF2, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+	0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347,
+	0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8,
+	0x115AF, 0x115B9, 0x115AF, 0x118C0, 0x118C1, 0x118C2, 0x118C3, 0x118C4,
+	0x118C5, 0x118C6, 0x118C7, 0x118C8, 0x118C9, 0x118CA, 0x118CB, 0x118CC,
+	0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1, 0x118D2, 0x118D3, 0x118D4,
+	0x118D5, 0x118D6, 0x118D7, 0x118D8, 0x118D9, 0x118DA, 0x118DB, 0x118DC,
+	0x118DD, 0x118DE, 0x118DF, 0x11935, 0x11930, 0x16E60, 0x16E61, 0x16E62,
+	0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67, 0x16E68, 0x16E69, 0x16E6A,
+	0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F, 0x16E70, 0x16E71, 0x16E72,
+	0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77, 0x16E78, 0x16E79, 0x16E7A,
+	0x16E7B, 0x16E7C, 0x16E7D, 0x16E7E, 0x16E7F, 0x1D157, 0x1D165, 0x1D158,
+	0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+	0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+	0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+	0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F,
+	0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927, 0x1E928, 0x1E929,
+	0x1E92A, 0x1E92B, 0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931,
+	0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937, 0x1E938, 0x1E939,
+	0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F, 0x1E940, 0x1E941,
+	0x1E942, 0x1E943, 0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE,
+	0x4FBB, 0x5002, 0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A,
+	0x514D, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D,
+	0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5,
+	0x5203, 0x34DF, 0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7,
+	0x52C9, 0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351,
+	0x535A, 0x5373, 0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070,
+	0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438,
+	0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584,
+	0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717,
+	0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B,
+	0x5832, 0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A,
+	0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8,
+	0x5A66, 0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3,
+	0x5BD8, 0x5BE7, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22,
+	0x3781, 0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6,
+	0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28,
+	0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6,
+	0x5ECA, 0x2A392, 0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22,
+	0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD,
+	0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7,
+	0x6148, 0x614C, 0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4,
+	0x61AF, 0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1,
+	0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4,
+	0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D,
+	0x6477, 0x3A6C, 0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649,
+	0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C,
+	0x80AD, 0x43D9, 0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3,
+	0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F,
+	0x6914, 0x3B9D, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB,
+	0x3C18, 0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA,
+	0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD,
+	0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85,
+	0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1,
+	0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B,
+	0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263,
+	0x719C, 0x243AB, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295,
+	0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8,
+	0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36,
+	0x753E, 0x24C92, 0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044,
+	0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E,
+	0x771F, 0x771F, 0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D,
+	0x784E, 0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5,
+	0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7,
+	0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80,
+	0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301,
+	0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9,
+	0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060,
+	0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E,
+	0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E,
+	0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD,
+	0x82E6, 0x26B3C, 0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD,
+	0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B,
+	0x26CD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C,
+	0x455D, 0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667,
+	0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B,
+	0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667,
+	0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE,
+	0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1,
+	0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE,
+	0x8ED4, 0x8F38, 0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E,
+	0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA,
+	0x958B, 0x4995, 0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723,
+	0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496,
+	0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7,
+	0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE,
+	0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB,
+	0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+};
+
+/* Primary composites, sorted by the pair they compose */
+static const uint32_t __uni_comp[941][3] = {
+	{ 0x003C, 0x0338, 0x226E }, { 0x003D, 0x0338, 0x2260 }, { 0x003E, 0x0338, 0x226F },
+	{ 0x0041, 0x0300, 0x00C0 }, { 0x0041, 0x0301, 0x00C1 }, { 0x0041, 0x0302, 0x00C2 },
+	{ 0x0041, 0x0303, 0x00C3 }, { 0x0041, 0x0304, 0x0100 }, { 0x0041, 0x0306, 0x0102 },
+	{ 0x0041, 0x0307, 0x0226 }, { 0x0041, 0x0308, 0x00C4 }, { 0x0041, 0x0309, 0x1EA2 },
+	{ 0x0041, 0x030A, 0x00C5 }, { 0x0041, 0x030C, 0x01CD }, { 0x0041, 0x030F, 0x0200 },
+	{ 0x0041, 0x0311, 0x0202 }, { 0x0041, 0x0323, 0x1EA0 }, { 0x0041, 0x0325, 0x1E00 },
+	{ 0x0041, 0x0328, 0x0104 }, { 0x0042, 0x0307, 0x1E02 }, { 0x0042, 0x0323, 0x1E04 },
+	{ 0x0042, 0x0331, 0x1E06 }, { 0x0043, 0x0301, 0x0106 }, { 0x0043, 0x0302, 0x0108 },
+	{ 0x0043, 0x0307, 0x010A }, { 0x0043, 0x030C, 0x010C }, { 0x0043, 0x0327, 0x00C7 },
+	{ 0x0044, 0x0307, 0x1E0A }, { 0x0044, 0x030C, 0x010E }, { 0x0044, 0x0323, 0x1E0C },
+	{ 0x0044, 0x0327, 0x1E10 }, { 0x0044, 0x032D, 0x1E12 }, { 0x0044, 0x0331, 0x1E0E },
+	{ 0x0045, 0x0300, 0x00C8 }, { 0x0045, 0x0301, 0x00C9 }, { 0x0045, 0x0302, 0x00CA },
+	{ 0x0045, 0x0303, 0x1EBC }, { 0x0045, 0x0304, 0x0112 }, { 0x0045, 0x0306, 0x0114 },
+	{ 0x0045, 0x0307, 0x0116 }, { 0x0045, 0x0308, 0x00CB }, { 0x0045, 0x0309, 0x1EBA },
+	{ 0x0045, 0x030C, 0x011A }, { 0x0045, 0x030F, 0x0204 }, { 0x0045, 0x0311, 0x0206 },
+	{ 0x0045, 0x0323, 0x1EB8 }, { 0x0045, 0x0327, 0x0228 }, { 0x0045, 0x0328, 0x0118 },
+	{ 0x0045, 0x032D, 0x1E18 }, { 0x0045, 0x0330, 0x1E1A }, { 0x0046, 0x0307, 0x1E1E },
+	{ 0x0047, 0x0301, 0x01F4 }, { 0x0047, 0x0302, 0x011C }, { 0x0047, 0x0304, 0x1E20 },
+	{ 0x0047, 0x0306, 0x011E }, { 0x0047, 0x0307, 0x0120 }, { 0x0047, 0x030C, 0x01E6 },
+	{ 0x0047, 0x0327, 0x0122 }, { 0x0048, 0x0302, 0x0124 }, { 0x0048, 0x0307, 0x1E22 },
+	{ 0x0048, 0x0308, 0x1E26 }, { 0x0048, 0x030C, 0x021E }, { 0x0048, 0x0323, 0x1E24 },
+	{ 0x0048, 0x0327, 0x1E28 }, { 0x0048, 0x032E, 0x1E2A }, { 0x0049, 0x0300, 0x00CC },
+	{ 0x0049, 0x0301, 0x00CD }, { 0x0049, 0x0302, 0x00CE }, { 0x0049, 0x0303, 0x0128 },
+	{ 0x0049, 0x0304, 0x012A }, { 0x0049, 0x0306, 0x012C }, { 0x0049, 0x0307, 0x0130 },
+	{ 0x0049, 0x0308, 0x00CF }, { 0x0049, 0x0309, 0x1EC8 }, { 0x0049, 0x030C, 0x01CF },
+	{ 0x0049, 0x030F, 0x0208 }, { 0x0049, 0x0311, 0x020A }, { 0x0049, 0x0323, 0x1ECA },
+	{ 0x0049, 0x0328, 0x012E }, { 0x0049, 0x0330, 0x1E2C }, { 0x004A, 0x0302, 0x0134 },
+	{ 0x004B, 0x0301, 0x1E30 }, { 0x004B, 0x030C, 0x01E8 }, { 0x004B, 0x0323, 0x1E32 },
+	{ 0x004B, 0x0327, 0x0136 }, { 0x004B, 0x0331, 0x1E34 }, { 0x004C, 0x0301, 0x0139 },
+	{ 0x004C, 0x030C, 0x013D }, { 0x004C, 0x0323, 0x1E36 }, { 0x004C, 0x0327, 0x013B },
+	{ 0x004C, 0x032D, 0x1E3C }, { 0x004C, 0x0331, 0x1E3A }, { 0x004D, 0x0301, 0x1E3E },
+	{ 0x004D, 0x0307, 0x1E40 }, { 0x004D, 0x0323, 0x1E42 }, { 0x004E, 0x0300, 0x01F8 },
+	{ 0x004E, 0x0301, 0x0143 }, { 0x004E, 0x0303, 0x00D1 }, { 0x004E, 0x0307, 0x1E44 },
+	{ 0x004E, 0x030C, 0x0147 }, { 0x004E, 0x0323, 0x1E46 }, { 0x004E, 0x0327, 0x0145 },
+	{ 0x004E, 0x032D, 0x1E4A }, { 0x004E, 0x0331, 0x1E48 }, { 0x004F, 0x0300, 0x00D2 },
+	{ 0x004F, 0x0301, 0x00D3 }, { 0x004F, 0x0302, 0x00D4 }, { 0x004F, 0x0303, 0x00D5 },
+	{ 0x004F, 0x0304, 0x014C }, { 0x004F, 0x0306, 0x014E }, { 0x004F, 0x0307, 0x022E },
+	{ 0x004F, 0x0308, 0x00D6 }, { 0x004F, 0x0309, 0x1ECE }, { 0x004F, 0x030B, 0x0150 },
+	{ 0x004F, 0x030C, 0x01D1 }, { 0x004F, 0x030F, 0x020C }, { 0x004F, 0x0311, 0x020E },
+	{ 0x004F, 0x031B, 0x01A0 }, { 0x004F, 0x0323, 0x1ECC }, { 0x004F, 0x0328, 0x01EA },
+	{ 0x0050, 0x0301, 0x1E54 }, { 0x0050, 0x0307, 0x1E56 }, { 0x0052, 0x0301, 0x0154 },
+	{ 0x0052, 0x0307, 0x1E58 }, { 0x0052, 0x030C, 0x0158 }, { 0x0052, 0x030F, 0x0210 },
+	{ 0x0052, 0x0311, 0x0212 }, { 0x0052, 0x0323, 0x1E5A }, { 0x0052, 0x0327, 0x0156 },
+	{ 0x0052, 0x0331, 0x1E5E }, { 0x0053, 0x0301, 0x015A }, { 0x0053, 0x0302, 0x015C },
+	{ 0x0053, 0x0307, 0x1E60 }, { 0x0053, 0x030C, 0x0160 }, { 0x0053, 0x0323, 0x1E62 },
+	{ 0x0053, 0x0326, 0x0218 }, { 0x0053, 0x0327, 0x015E }, { 0x0054, 0x0307, 0x1E6A },
+	{ 0x0054, 0x030C, 0x0164 }, { 0x0054, 0x0323, 0x1E6C }, { 0x0054, 0x0326, 0x021A },
+	{ 0x0054, 0x0327, 0x0162 }, { 0x0054, 0x032D, 0x1E70 }, { 0x0054, 0x0331, 0x1E6E },
+	{ 0x0055, 0x0300, 0x00D9 }, { 0x0055, 0x0301, 0x00DA }, { 0x0055, 0x0302, 0x00DB },
+	{ 0x0055, 0x0303, 0x0168 }, { 0x0055, 0x0304, 0x016A }, { 0x0055, 0x0306, 0x016C },
+	{ 0x0055, 0x0308, 0x00DC }, { 0x0055, 0x0309, 0x1EE6 }, { 0x0055, 0x030A, 0x016E },
+	{ 0x0055, 0x030B, 0x0170 }, { 0x0055, 0x030C, 0x01D3 }, { 0x0055, 0x030F, 0x0214 },
+	{ 0x0055, 0x0311, 0x0216 }, { 0x0055, 0x031B, 0x01AF }, { 0x0055, 0x0323, 0x1EE4 },
+	{ 0x0055, 0x0324, 0x1E72 }, { 0x0055, 0x0328, 0x0172 }, { 0x0055, 0x032D, 0x1E76 },
+	{ 0x0055, 0x0330, 0x1E74 }, { 0x0056, 0x0303, 0x1E7C }, { 0x0056, 0x0323, 0x1E7E },
+	{ 0x0057, 0x0300, 0x1E80 }, { 0x0057, 0x0301, 0x1E82 }, { 0x0057, 0x0302, 0x0174 },
+	{ 0x0057, 0x0307, 0x1E86 }, { 0x0057, 0x0308, 0x1E84 }, { 0x0057, 0x0323, 0x1E88 },
+	{ 0x0058, 0x0307, 0x1E8A }, { 0x0058, 0x0308, 0x1E8C }, { 0x0059, 0x0300, 0x1EF2 },
+	{ 0x0059, 0x0301, 0x00DD }, { 0x0059, 0x0302, 0x0176 }, { 0x0059, 0x0303, 0x1EF8 },
+	{ 0x0059, 0x0304, 0x0232 }, { 0x0059, 0x0307, 0x1E8E }, { 0x0059, 0x0308, 0x0178 },
+	{ 0x0059, 0x0309, 0x1EF6 }, { 0x0059, 0x0323, 0x1EF4 }, { 0x005A, 0x0301, 0x0179 },
+	{ 0x005A, 0x0302, 0x1E90 }, { 0x005A, 0x0307, 0x017B }, { 0x005A, 0x030C, 0x017D },
+	{ 0x005A, 0x0323, 0x1E92 }, { 0x005A, 0x0331, 0x1E94 }, { 0x0061, 0x0300, 0x00E0 },
+	{ 0x0061, 0x0301, 0x00E1 }, { 0x0061, 0x0302, 0x00E2 }, { 0x0061, 0x0303, 0x00E3 },
+	{ 0x0061, 0x0304, 0x0101 }, { 0x0061, 0x0306, 0x0103 }, { 0x0061, 0x0307, 0x0227 },
+	{ 0x0061, 0x0308, 0x00E4 }, { 0x0061, 0x0309, 0x1EA3 }, { 0x0061, 0x030A, 0x00E5 },
+	{ 0x0061, 0x030C, 0x01CE }, { 0x0061, 0x030F, 0x0201 }, { 0x0061, 0x0311, 0x0203 },
+	{ 0x0061, 0x0323, 0x1EA1 }, { 0x0061, 0x0325, 0x1E01 }, { 0x0061, 0x0328, 0x0105 },
+	{ 0x0062, 0x0307, 0x1E03 }, { 0x0062, 0x0323, 0x1E05 }, { 0x0062, 0x0331, 0x1E07 },
+	{ 0x0063, 0x0301, 0x0107 }, { 0x0063, 0x0302, 0x0109 }, { 0x0063, 0x0307, 0x010B },
+	{ 0x0063, 0x030C, 0x010D }, { 0x0063, 0x0327, 0x00E7 }, { 0x0064, 0x0307, 0x1E0B },
+	{ 0x0064, 0x030C, 0x010F }, { 0x0064, 0x0323, 0x1E0D }, { 0x0064, 0x0327, 0x1E11 },
+	{ 0x0064, 0x032D, 0x1E13 }, { 0x0064, 0x0331, 0x1E0F }, { 0x0065, 0x0300, 0x00E8 },
+	{ 0x0065, 0x0301, 0x00E9 }, { 0x0065, 0x0302, 0x00EA }, { 0x0065, 0x0303, 0x1EBD },
+	{ 0x0065, 0x0304, 0x0113 }, { 0x0065, 0x0306, 0x0115 }, { 0x0065, 0x0307, 0x0117 },
+	{ 0x0065, 0x0308, 0x00EB }, { 0x0065, 0x0309, 0x1EBB }, { 0x0065, 0x030C, 0x011B },
+	{ 0x0065, 0x030F, 0x0205 }, { 0x0065, 0x0311, 0x0207 }, { 0x0065, 0x0323, 0x1EB9 },
+	{ 0x0065, 0x0327, 0x0229 }, { 0x0065, 0x0328, 0x0119 }, { 0x0065, 0x032D, 0x1E19 },
+	{ 0x0065, 0x0330, 0x1E1B }, { 0x0066, 0x0307, 0x1E1F }, { 0x0067, 0x0301, 0x01F5 },
+	{ 0x0067, 0x0302, 0x011D }, { 0x0067, 0x0304, 0x1E21 }, { 0x0067, 0x0306, 0x011F },
+	{ 0x0067, 0x0307, 0x0121 }, { 0x0067, 0x030C, 0x01E7 }, { 0x0067, 0x0327, 0x0123 },
+	{ 0x0068, 0x0302, 0x0125 }, { 0x0068, 0x0307, 0x1E23 }, { 0x0068, 0x0308, 0x1E27 },
+	{ 0x0068, 0x030C, 0x021F }, { 0x0068, 0x0323, 0x1E25 }, { 0x0068, 0x0327, 0x1E29 },
+	{ 0x0068, 0x032E, 0x1E2B }, { 0x0068, 0x0331, 0x1E96 }, { 0x0069, 0x0300, 0x00EC },
+	{ 0x0069, 0x0301, 0x00ED }, { 0x0069, 0x0302, 0x00EE }, { 0x0069, 0x0303, 0x0129 },
+	{ 0x0069, 0x0304, 0x012B }, { 0x0069, 0x0306, 0x012D }, { 0x0069, 0x0308, 0x00EF },
+	{ 0x0069, 0x0309, 0x1EC9 }, { 0x0069, 0x030C, 0x01D0 }, { 0x0069, 0x030F, 0x0209 },
+	{ 0x0069, 0x0311, 0x020B }, { 0x0069, 0x0323, 0x1ECB }, { 0x0069, 0x0328, 0x012F },
+	{ 0x0069, 0x0330, 0x1E2D }, { 0x006A, 0x0302, 0x0135 }, { 0x006A, 0x030C, 0x01F0 },
+	{ 0x006B, 0x0301, 0x1E31 }, { 0x006B, 0x030C, 0x01E9 }, { 0x006B, 0x0323, 0x1E33 },
+	{ 0x006B, 0x0327, 0x0137 }, { 0x006B, 0x0331, 0x1E35 }, { 0x006C, 0x0301, 0x013A },
+	{ 0x006C, 0x030C, 0x013E }, { 0x006C, 0x0323, 0x1E37 }, { 0x006C, 0x0327, 0x013C },
+	{ 0x006C, 0x032D, 0x1E3D }, { 0x006C, 0x0331, 0x1E3B }, { 0x006D, 0x0301, 0x1E3F },
+	{ 0x006D, 0x0307, 0x1E41 }, { 0x006D, 0x0323, 0x1E43 }, { 0x006E, 0x0300, 0x01F9 },
+	{ 0x006E, 0x0301, 0x0144 }, { 0x006E, 0x0303, 0x00F1 }, { 0x006E, 0x0307, 0x1E45 },
+	{ 0x006E, 0x030C, 0x0148 }, { 0x006E, 0x0323, 0x1E47 }, { 0x006E, 0x0327, 0x0146 },
+	{ 0x006E, 0x032D, 0x1E4B }, { 0x006E, 0x0331, 0x1E49 }, { 0x006F, 0x0300, 0x00F2 },
+	{ 0x006F, 0x0301, 0x00F3 }, { 0x006F, 0x0302, 0x00F4 }, { 0x006F, 0x0303, 0x00F5 },
+	{ 0x006F, 0x0304, 0x014D }, { 0x006F, 0x0306, 0x014F }, { 0x006F, 0x0307, 0x022F },
+	{ 0x006F, 0x0308, 0x00F6 }, { 0x006F, 0x0309, 0x1ECF }, { 0x006F, 0x030B, 0x0151 },
+	{ 0x006F, 0x030C, 0x01D2 }, { 0x006F, 0x030F, 0x020D }, { 0x006F, 0x0311, 0x020F },
+	{ 0x006F, 0x031B, 0x01A1 }, { 0x006F, 0x0323, 0x1ECD }, { 0x006F, 0x0328, 0x01EB },
+	{ 0x0070, 0x0301, 0x1E55 }, { 0x0070, 0x0307, 0x1E57 }, { 0x0072, 0x0301, 0x0155 },
+	{ 0x0072, 0x0307, 0x1E59 }, { 0x0072, 0x030C, 0x0159 }, { 0x0072, 0x030F, 0x0211 },
+	{ 0x0072, 0x0311, 0x0213 }, { 0x0072, 0x0323, 0x1E5B }, { 0x0072, 0x0327, 0x0157 },
+	{ 0x0072, 0x0331, 0x1E5F }, { 0x0073, 0x0301, 0x015B }, { 0x0073, 0x0302, 0x015D },
+	{ 0x0073, 0x0307, 0x1E61 }, { 0x0073, 0x030C, 0x0161 }, { 0x0073, 0x0323, 0x1E63 },
+	{ 0x0073, 0x0326, 0x0219 }, { 0x0073, 0x0327, 0x015F }, { 0x0074, 0x0307, 0x1E6B },
+	{ 0x0074, 0x0308, 0x1E97 }, { 0x0074, 0x030C, 0x0165 }, { 0x0074, 0x0323, 0x1E6D },
+	{ 0x0074, 0x0326, 0x021B }, { 0x0074, 0x0327, 0x0163 }, { 0x0074, 0x032D, 0x1E71 },
+	{ 0x0074, 0x0331, 0x1E6F }, { 0x0075, 0x0300, 0x00F9 }, { 0x0075, 0x0301, 0x00FA },
+	{ 0x0075, 0x0302, 0x00FB }, { 0x0075, 0x0303, 0x0169 }, { 0x0075, 0x0304, 0x016B },
+	{ 0x0075, 0x0306, 0x016D }, { 0x0075, 0x0308, 0x00FC }, { 0x0075, 0x0309, 0x1EE7 },
+	{ 0x0075, 0x030A, 0x016F }, { 0x0075, 0x030B, 0x0171 }, { 0x0075, 0x030C, 0x01D4 },
+	{ 0x0075, 0x030F, 0x0215 }, { 0x0075, 0x0311, 0x0217 }, { 0x0075, 0x031B, 0x01B0 },
+	{ 0x0075, 0x0323, 0x1EE5 }, { 0x0075, 0x0324, 0x1E73 }, { 0x0075, 0x0328, 0x0173 },
+	{ 0x0075, 0x032D, 0x1E77 }, { 0x0075, 0x0330, 0x1E75 }, { 0x0076, 0x0303, 0x1E7D },
+	{ 0x0076, 0x0323, 0x1E7F }, { 0x0077, 0x0300, 0x1E81 }, { 0x0077, 0x0301, 0x1E83 },
+	{ 0x0077, 0x0302, 0x0175 }, { 0x0077, 0x0307, 0x1E87 }, { 0x0077, 0x0308, 0x1E85 },
+	{ 0x0077, 0x030A, 0x1E98 }, { 0x0077, 0x0323, 0x1E89 }, { 0x0078, 0x0307, 0x1E8B },
+	{ 0x0078, 0x0308, 0x1E8D }, { 0x0079, 0x0300, 0x1EF3 }, { 0x0079, 0x0301, 0x00FD },
+	{ 0x0079, 0x0302, 0x0177 }, { 0x0079, 0x0303, 0x1EF9 }, { 0x0079, 0x0304, 0x0233 },
+	{ 0x0079, 0x0307, 0x1E8F }, { 0x0079, 0x0308, 0x00FF }, { 0x0079, 0x0309, 0x1EF7 },
+	{ 0x0079, 0x030A, 0x1E99 }, { 0x0079, 0x0323, 0x1EF5 }, { 0x007A, 0x0301, 0x017A },
+	{ 0x007A, 0x0302, 0x1E91 }, { 0x007A, 0x0307, 0x017C }, { 0x007A, 0x030C, 0x017E },
+	{ 0x007A, 0x0323, 0x1E93 }, { 0x007A, 0x0331, 0x1E95 }, { 0x00A8, 0x0300, 0x1FED },
+	{ 0x00A8, 0x0301, 0x0385 }, { 0x00A8, 0x0342, 0x1FC1 }, { 0x00C2, 0x0300, 0x1EA6 },
+	{ 0x00C2, 0x0301, 0x1EA4 }, { 0x00C2, 0x0303, 0x1EAA }, { 0x00C2, 0x0309, 0x1EA8 },
+	{ 0x00C4, 0x0304, 0x01DE }, { 0x00C5, 0x0301, 0x01FA }, { 0x00C6, 0x0301, 0x01FC },
+	{ 0x00C6, 0x0304, 0x01E2 }, { 0x00C7, 0x0301, 0x1E08 }, { 0x00CA, 0x0300, 0x1EC0 },
+	{ 0x00CA, 0x0301, 0x1EBE }, { 0x00CA, 0x0303, 0x1EC4 }, { 0x00CA, 0x0309, 0x1EC2 },
+	{ 0x00CF, 0x0301, 0x1E2E }, { 0x00D4, 0x0300, 0x1ED2 }, { 0x00D4, 0x0301, 0x1ED0 },
+	{ 0x00D4, 0x0303, 0x1ED6 }, { 0x00D4, 0x0309, 0x1ED4 }, { 0x00D5, 0x0301, 0x1E4C },
+	{ 0x00D5, 0x0304, 0x022C }, { 0x00D5, 0x0308, 0x1E4E }, { 0x00D6, 0x0304, 0x022A },
+	{ 0x00D8, 0x0301, 0x01FE }, { 0x00DC, 0x0300, 0x01DB }, { 0x00DC, 0x0301, 0x01D7 },
+	{ 0x00DC, 0x0304, 0x01D5 }, { 0x00DC, 0x030C, 0x01D9 }, { 0x00E2, 0x0300, 0x1EA7 },
+	{ 0x00E2, 0x0301, 0x1EA5 }, { 0x00E2, 0x0303, 0x1EAB }, { 0x00E2, 0x0309, 0x1EA9 },
+	{ 0x00E4, 0x0304, 0x01DF }, { 0x00E5, 0x0301, 0x01FB }, { 0x00E6, 0x0301, 0x01FD },
+	{ 0x00E6, 0x0304, 0x01E3 }, { 0x00E7, 0x0301, 0x1E09 }, { 0x00EA, 0x0300, 0x1EC1 },
+	{ 0x00EA, 0x0301, 0x1EBF }, { 0x00EA, 0x0303, 0x1EC5 }, { 0x00EA, 0x0309, 0x1EC3 },
+	{ 0x00EF, 0x0301, 0x1E2F }, { 0x00F4, 0x0300, 0x1ED3 }, { 0x00F4, 0x0301, 0x1ED1 },
+	{ 0x00F4, 0x0303, 0x1ED7 }, { 0x00F4, 0x0309, 0x1ED5 }, { 0x00F5, 0x0301, 0x1E4D },
+	{ 0x00F5, 0x0304, 0x022D }, { 0x00F5, 0x0308, 0x1E4F }, { 0x00F6, 0x0304, 0x022B },
+	{ 0x00F8, 0x0301, 0x01FF }, { 0x00FC, 0x0300, 0x01DC }, { 0x00FC, 0x0301, 0x01D8 },
+	{ 0x00FC, 0x0304, 0x01D6 }, { 0x00FC, 0x030C, 0x01DA }, { 0x0102, 0x0300, 0x1EB0 },
+	{ 0x0102, 0x0301, 0x1EAE }, { 0x0102, 0x0303, 0x1EB4 }, { 0x0102, 0x0309, 0x1EB2 },
+	{ 0x0103, 0x0300, 0x1EB1 }, { 0x0103, 0x0301, 0x1EAF }, { 0x0103, 0x0303, 0x1EB5 },
+	{ 0x0103, 0x0309, 0x1EB3 }, { 0x0112, 0x0300, 0x1E14 }, { 0x0112, 0x0301, 0x1E16 },
+	{ 0x0113, 0x0300, 0x1E15 }, { 0x0113, 0x0301, 0x1E17 }, { 0x014C, 0x0300, 0x1E50 },
+	{ 0x014C, 0x0301, 0x1E52 }, { 0x014D, 0x0300, 0x1E51 }, { 0x014D, 0x0301, 0x1E53 },
+	{ 0x015A, 0x0307, 0x1E64 }, { 0x015B, 0x0307, 0x1E65 }, { 0x0160, 0x0307, 0x1E66 },
+	{ 0x0161, 0x0307, 0x1E67 }, { 0x0168, 0x0301, 0x1E78 }, { 0x0169, 0x0301, 0x1E79 },
+	{ 0x016A, 0x0308, 0x1E7A }, { 0x016B, 0x0308, 0x1E7B }, { 0x017F, 0x0307, 0x1E9B },
+	{ 0x01A0, 0x0300, 0x1EDC }, { 0x01A0, 0x0301, 0x1EDA }, { 0x01A0, 0x0303, 0x1EE0 },
+	{ 0x01A0, 0x0309, 0x1EDE }, { 0x01A0, 0x0323, 0x1EE2 }, { 0x01A1, 0x0300, 0x1EDD },
+	{ 0x01A1, 0x0301, 0x1EDB }, { 0x01A1, 0x0303, 0x1EE1 }, { 0x01A1, 0x0309, 0x1EDF },
+	{ 0x01A1, 0x0323, 0x1EE3 }, { 0x01AF, 0x0300, 0x1EEA }, { 0x01AF, 0x0301, 0x1EE8 },
+	{ 0x01AF, 0x0303, 0x1EEE }, { 0x01AF, 0x0309, 0x1EEC }, { 0x01AF, 0x0323, 0x1EF0 },
+	{ 0x01B0, 0x0300, 0x1EEB }, { 0x01B0, 0x0301, 0x1EE9 }, { 0x01B0, 0x0303, 0x1EEF },
+	{ 0x01B0, 0x0309, 0x1EED }, { 0x01B0, 0x0323, 0x1EF1 }, { 0x01B7, 0x030C, 0x01EE },
+	{ 0x01EA, 0x0304, 0x01EC }, { 0x01EB, 0x0304, 0x01ED }, { 0x0226, 0x0304, 0x01E0 },
+	{ 0x0227, 0x0304, 0x01E1 }, { 0x0228, 0x0306, 0x1E1C }, { 0x0229, 0x0306, 0x1E1D },
+	{ 0x022E, 0x0304, 0x0230 }, { 0x022F, 0x0304, 0x0231 }, { 0x0292, 0x030C, 0x01EF },
+	{ 0x0391, 0x0300, 0x1FBA }, { 0x0391, 0x0301, 0x0386 }, { 0x0391, 0x0304, 0x1FB9 },
+	{ 0x0391, 0x0306, 0x1FB8 }, { 0x0391, 0x0313, 0x1F08 }, { 0x0391, 0x0314, 0x1F09 },
+	{ 0x0391, 0x0345, 0x1FBC }, { 0x0395, 0x0300, 0x1FC8 }, { 0x0395, 0x0301, 0x0388 },
+	{ 0x0395, 0x0313, 0x1F18 }, { 0x0395, 0x0314, 0x1F19 }, { 0x0397, 0x0300, 0x1FCA },
+	{ 0x0397, 0x0301, 0x0389 }, { 0x0397, 0x0313, 0x1F28 }, { 0x0397, 0x0314, 0x1F29 },
+	{ 0x0397, 0x0345, 0x1FCC }, { 0x0399, 0x0300, 0x1FDA }, { 0x0399, 0x0301, 0x038A },
+	{ 0x0399, 0x0304, 0x1FD9 }, { 0x0399, 0x0306, 0x1FD8 }, { 0x0399, 0x0308, 0x03AA },
+	{ 0x0399, 0x0313, 0x1F38 }, { 0x0399, 0x0314, 0x1F39 }, { 0x039F, 0x0300, 0x1FF8 },
+	{ 0x039F, 0x0301, 0x038C }, { 0x039F, 0x0313, 0x1F48 }, { 0x039F, 0x0314, 0x1F49 },
+	{ 0x03A1, 0x0314, 0x1FEC }, { 0x03A5, 0x0300, 0x1FEA }, { 0x03A5, 0x0301, 0x038E },
+	{ 0x03A5, 0x0304, 0x1FE9 }, { 0x03A5, 0x0306, 0x1FE8 }, { 0x03A5, 0x0308, 0x03AB },
+	{ 0x03A5, 0x0314, 0x1F59 }, { 0x03A9, 0x0300, 0x1FFA }, { 0x03A9, 0x0301, 0x038F },
+	{ 0x03A9, 0x0313, 0x1F68 }, { 0x03A9, 0x0314, 0x1F69 }, { 0x03A9, 0x0345, 0x1FFC },
+	{ 0x03AC, 0x0345, 0x1FB4 }, { 0x03AE, 0x0345, 0x1FC4 }, { 0x03B1, 0x0300, 0x1F70 },
+	{ 0x03B1, 0x0301, 0x03AC }, { 0x03B1, 0x0304, 0x1FB1 }, { 0x03B1, 0x0306, 0x1FB0 },
+	{ 0x03B1, 0x0313, 0x1F00 }, { 0x03B1, 0x0314, 0x1F01 }, { 0x03B1, 0x0342, 0x1FB6 },
+	{ 0x03B1, 0x0345, 0x1FB3 }, { 0x03B5, 0x0300, 0x1F72 }, { 0x03B5, 0x0301, 0x03AD },
+	{ 0x03B5, 0x0313, 0x1F10 }, { 0x03B5, 0x0314, 0x1F11 }, { 0x03B7, 0x0300, 0x1F74 },
+	{ 0x03B7, 0x0301, 0x03AE }, { 0x03B7, 0x0313, 0x1F20 }, { 0x03B7, 0x0314, 0x1F21 },
+	{ 0x03B7, 0x0342, 0x1FC6 }, { 0x03B7, 0x0345, 0x1FC3 }, { 0x03B9, 0x0300, 0x1F76 },
+	{ 0x03B9, 0x0301, 0x03AF }, { 0x03B9, 0x0304, 0x1FD1 }, { 0x03B9, 0x0306, 0x1FD0 },
+	{ 0x03B9, 0x0308, 0x03CA }, { 0x03B9, 0x0313, 0x1F30 }, { 0x03B9, 0x0314, 0x1F31 },
+	{ 0x03B9, 0x0342, 0x1FD6 }, { 0x03BF, 0x0300, 0x1F78 }, { 0x03BF, 0x0301, 0x03CC },
+	{ 0x03BF, 0x0313, 0x1F40 }, { 0x03BF, 0x0314, 0x1F41 }, { 0x03C1, 0x0313, 0x1FE4 },
+	{ 0x03C1, 0x0314, 0x1FE5 }, { 0x03C5, 0x0300, 0x1F7A }, { 0x03C5, 0x0301, 0x03CD },
+	{ 0x03C5, 0x0304, 0x1FE1 }, { 0x03C5, 0x0306, 0x1FE0 }, { 0x03C5, 0x0308, 0x03CB },
+	{ 0x03C5, 0x0313, 0x1F50 }, { 0x03C5, 0x0314, 0x1F51 }, { 0x03C5, 0x0342, 0x1FE6 },
+	{ 0x03C9, 0x0300, 0x1F7C }, { 0x03C9, 0x0301, 0x03CE }, { 0x03C9, 0x0313, 0x1F60 },
+	{ 0x03C9, 0x0314, 0x1F61 }, { 0x03C9, 0x0342, 0x1FF6 }, { 0x03C9, 0x0345, 0x1FF3 },
+	{ 0x03CA, 0x0300, 0x1FD2 }, { 0x03CA, 0x0301, 0x0390 }, { 0x03CA, 0x0342, 0x1FD7 },
+	{ 0x03CB, 0x0300, 0x1FE2 }, { 0x03CB, 0x0301, 0x03B0 }, { 0x03CB, 0x0342, 0x1FE7 },
+	{ 0x03CE, 0x0345, 0x1FF4 }, { 0x03D2, 0x0301, 0x03D3 }, { 0x03D2, 0x0308, 0x03D4 },
+	{ 0x0406, 0x0308, 0x0407 }, { 0x0410, 0x0306, 0x04D0 }, { 0x0410, 0x0308, 0x04D2 },
+	{ 0x0413, 0x0301, 0x0403 }, { 0x0415, 0x0300, 0x0400 }, { 0x0415, 0x0306, 0x04D6 },
+	{ 0x0415, 0x0308, 0x0401 }, { 0x0416, 0x0306, 0x04C1 }, { 0x0416, 0x0308, 0x04DC },
+	{ 0x0417, 0x0308, 0x04DE }, { 0x0418, 0x0300, 0x040D }, { 0x0418, 0x0304, 0x04E2 },
+	{ 0x0418, 0x0306, 0x0419 }, { 0x0418, 0x0308, 0x04E4 }, { 0x041A, 0x0301, 0x040C },
+	{ 0x041E, 0x0308, 0x04E6 }, { 0x0423, 0x0304, 0x04EE }, { 0x0423, 0x0306, 0x040E },
+	{ 0x0423, 0x0308, 0x04F0 }, { 0x0423, 0x030B, 0x04F2 }, { 0x0427, 0x0308, 0x04F4 },
+	{ 0x042B, 0x0308, 0x04F8 }, { 0x042D, 0x0308, 0x04EC }, { 0x0430, 0x0306, 0x04D1 },
+	{ 0x0430, 0x0308, 0x04D3 }, { 0x0433, 0x0301, 0x0453 }, { 0x0435, 0x0300, 0x0450 },
+	{ 0x0435, 0x0306, 0x04D7 }, { 0x0435, 0x0308, 0x0451 }, { 0x0436, 0x0306, 0x04C2 },
+	{ 0x0436, 0x0308, 0x04DD }, { 0x0437, 0x0308, 0x04DF }, { 0x0438, 0x0300, 0x045D },
+	{ 0x0438, 0x0304, 0x04E3 }, { 0x0438, 0x0306, 0x0439 }, { 0x0438, 0x0308, 0x04E5 },
+	{ 0x043A, 0x0301, 0x045C }, { 0x043E, 0x0308, 0x04E7 }, { 0x0443, 0x0304, 0x04EF },
+	{ 0x0443, 0x0306, 0x045E }, { 0x0443, 0x0308, 0x04F1 }, { 0x0443, 0x030B, 0x04F3 },
+	{ 0x0447, 0x0308, 0x04F5 }, { 0x044B, 0x0308, 0x04F9 }, { 0x044D, 0x0308, 0x04ED },
+	{ 0x0456, 0x0308, 0x0457 }, { 0x0474, 0x030F, 0x0476 }, { 0x0475, 0x030F, 0x0477 },
+	{ 0x04D8, 0x0308, 0x04DA }, { 0x04D9, 0x0308, 0x04DB }, { 0x04E8, 0x0308, 0x04EA },
+	{ 0x04E9, 0x0308, 0x04EB }, { 0x0627, 0x0653, 0x0622 }, { 0x0627, 0x0654, 0x0623 },
+	{ 0x0627, 0x0655, 0x0625 }, { 0x0648, 0x0654, 0x0624 }, { 0x064A, 0x0654, 0x0626 },
+	{ 0x06C1, 0x0654, 0x06C2 }, { 0x06D2, 0x0654, 0x06D3 }, { 0x06D5, 0x0654, 0x06C0 },
+	{ 0x0928, 0x093C, 0x0929 }, { 0x0930, 0x093C, 0x0931 }, { 0x0933, 0x093C, 0x0934 },
+	{ 0x09C7, 0x09BE, 0x09CB }, { 0x09C7, 0x09D7, 0x09CC }, { 0x0B47, 0x0B3E, 0x0B4B },
+	{ 0x0B47, 0x0B56, 0x0B48 }, { 0x0B47, 0x0B57, 0x0B4C }, { 0x0B92, 0x0BD7, 0x0B94 },
+	{ 0x0BC6, 0x0BBE, 0x0BCA }, { 0x0BC6, 0x0BD7, 0x0BCC }, { 0x0BC7, 0x0BBE, 0x0BCB },
+	{ 0x0C46, 0x0C56, 0x0C48 }, { 0x0CBF, 0x0CD5, 0x0CC0 }, { 0x0CC6, 0x0CC2, 0x0CCA },
+	{ 0x0CC6, 0x0CD5, 0x0CC7 }, { 0x0CC6, 0x0CD6, 0x0CC8 }, { 0x0CCA, 0x0CD5, 0x0CCB },
+	{ 0x0D46, 0x0D3E, 0x0D4A }, { 0x0D46, 0x0D57, 0x0D4C }, { 0x0D47, 0x0D3E, 0x0D4B },
+	{ 0x0DD9, 0x0DCA, 0x0DDA }, { 0x0DD9, 0x0DCF, 0x0DDC }, { 0x0DD9, 0x0DDF, 0x0DDE },
+	{ 0x0DDC, 0x0DCA, 0x0DDD }, { 0x1025, 0x102E, 0x1026 }, { 0x1B05, 0x1B35, 0x1B06 },
+	{ 0x1B07, 0x1B35, 0x1B08 }, { 0x1B09, 0x1B35, 0x1B0A }, { 0x1B0B, 0x1B35, 0x1B0C },
+	{ 0x1B0D, 0x1B35, 0x1B0E }, { 0x1B11, 0x1B35, 0x1B12 }, { 0x1B3A, 0x1B35, 0x1B3B },
+	{ 0x1B3C, 0x1B35, 0x1B3D }, { 0x1B3E, 0x1B35, 0x1B40 }, { 0x1B3F, 0x1B35, 0x1B41 },
+	{ 0x1B42, 0x1B35, 0x1B43 }, { 0x1E36, 0x0304, 0x1E38 }, { 0x1E37, 0x0304, 0x1E39 },
+	{ 0x1E5A, 0x0304, 0x1E5C }, { 0x1E5B, 0x0304, 0x1E5D }, { 0x1E62, 0x0307, 0x1E68 },
+	{ 0x1E63, 0x0307, 0x1E69 }, { 0x1EA0, 0x0302, 0x1EAC }, { 0x1EA0, 0x0306, 0x1EB6 },
+	{ 0x1EA1, 0x0302, 0x1EAD }, { 0x1EA1, 0x0306, 0x1EB7 }, { 0x1EB8, 0x0302, 0x1EC6 },
+	{ 0x1EB9, 0x0302, 0x1EC7 }, { 0x1ECC, 0x0302, 0x1ED8 }, { 0x1ECD, 0x0302, 0x1ED9 },
+	{ 0x1F00, 0x0300, 0x1F02 }, { 0x1F00, 0x0301, 0x1F04 }, { 0x1F00, 0x0342, 0x1F06 },
+	{ 0x1F00, 0x0345, 0x1F80 }, { 0x1F01, 0x0300, 0x1F03 }, { 0x1F01, 0x0301, 0x1F05 },
+	{ 0x1F01, 0x0342, 0x1F07 }, { 0x1F01, 0x0345, 0x1F81 }, { 0x1F02, 0x0345, 0x1F82 },
+	{ 0x1F03, 0x0345, 0x1F83 }, { 0x1F04, 0x0345, 0x1F84 }, { 0x1F05, 0x0345, 0x1F85 },
+	{ 0x1F06, 0x0345, 0x1F86 }, { 0x1F07, 0x0345, 0x1F87 }, { 0x1F08, 0x0300, 0x1F0A },
+	{ 0x1F08, 0x0301, 0x1F0C }, { 0x1F08, 0x0342, 0x1F0E }, { 0x1F08, 0x0345, 0x1F88 },
+	{ 0x1F09, 0x0300, 0x1F0B }, { 0x1F09, 0x0301, 0x1F0D }, { 0x1F09, 0x0342, 0x1F0F },
+	{ 0x1F09, 0x0345, 0x1F89 }, { 0x1F0A, 0x0345, 0x1F8A }, { 0x1F0B, 0x0345, 0x1F8B },
+	{ 0x1F0C, 0x0345, 0x1F8C }, { 0x1F0D, 0x0345, 0x1F8D }, { 0x1F0E, 0x0345, 0x1F8E },
+	{ 0x1F0F, 0x0345, 0x1F8F }, { 0x1F10, 0x0300, 0x1F12 }, { 0x1F10, 0x0301, 0x1F14 },
+	{ 0x1F11, 0x0300, 0x1F13 }, { 0x1F11, 0x0301, 0x1F15 }, { 0x1F18, 0x0300, 0x1F1A },
+	{ 0x1F18, 0x0301, 0x1F1C }, { 0x1F19, 0x0300, 0x1F1B }, { 0x1F19, 0x0301, 0x1F1D },
+	{ 0x1F20, 0x0300, 0x1F22 }, { 0x1F20, 0x0301, 0x1F24 }, { 0x1F20, 0x0342, 0x1F26 },
+	{ 0x1F20, 0x0345, 0x1F90 }, { 0x1F21, 0x0300, 0x1F23 }, { 0x1F21, 0x0301, 0x1F25 },
+	{ 0x1F21, 0x0342, 0x1F27 }, { 0x1F21, 0x0345, 0x1F91 }, { 0x1F22, 0x0345, 0x1F92 },
+	{ 0x1F23, 0x0345, 0x1F93 }, { 0x1F24, 0x0345, 0x1F94 }, { 0x1F25, 0x0345, 0x1F95 },
+	{ 0x1F26, 0x0345, 0x1F96 }, { 0x1F27, 0x0345, 0x1F97 }, { 0x1F28, 0x0300, 0x1F2A },
+	{ 0x1F28, 0x0301, 0x1F2C }, { 0x1F28, 0x0342, 0x1F2E }, { 0x1F28, 0x0345, 0x1F98 },
+	{ 0x1F29, 0x0300, 0x1F2B }, { 0x1F29, 0x0301, 0x1F2D }, { 0x1F29, 0x0342, 0x1F2F },
+	{ 0x1F29, 0x0345, 0x1F99 }, { 0x1F2A, 0x0345, 0x1F9A }, { 0x1F2B, 0x0345, 0x1F9B },
+	{ 0x1F2C, 0x0345, 0x1F9C }, { 0x1F2D, 0x0345, 0x1F9D }, { 0x1F2E, 0x0345, 0x1F9E },
+	{ 0x1F2F, 0x0345, 0x1F9F }, { 0x1F30, 0x0300, 0x1F32 }, { 0x1F30, 0x0301, 0x1F34 },
+	{ 0x1F30, 0x0342, 0x1F36 }, { 0x1F31, 0x0300, 0x1F33 }, { 0x1F31, 0x0301, 0x1F35 },
+	{ 0x1F31, 0x0342, 0x1F37 }, { 0x1F38, 0x0300, 0x1F3A }, { 0x1F38, 0x0301, 0x1F3C },
+	{ 0x1F38, 0x0342, 0x1F3E }, { 0x1F39, 0x0300, 0x1F3B }, { 0x1F39, 0x0301, 0x1F3D },
+	{ 0x1F39, 0x0342, 0x1F3F }, { 0x1F40, 0x0300, 0x1F42 }, { 0x1F40, 0x0301, 0x1F44 },
+	{ 0x1F41, 0x0300, 0x1F43 }, { 0x1F41, 0x0301, 0x1F45 }, { 0x1F48, 0x0300, 0x1F4A },
+	{ 0x1F48, 0x0301, 0x1F4C }, { 0x1F49, 0x0300, 0x1F4B }, { 0x1F49, 0x0301, 0x1F4D },
+	{ 0x1F50, 0x0300, 0x1F52 }, { 0x1F50, 0x0301, 0x1F54 }, { 0x1F50, 0x0342, 0x1F56 },
+	{ 0x1F51, 0x0300, 0x1F53 }, { 0x1F51, 0x0301, 0x1F55 }, { 0x1F51, 0x0342, 0x1F57 },
+	{ 0x1F59, 0x0300, 0x1F5B }, { 0x1F59, 0x0301, 0x1F5D }, { 0x1F59, 0x0342, 0x1F5F },
+	{ 0x1F60, 0x0300, 0x1F62 }, { 0x1F60, 0x0301, 0x1F64 }, { 0x1F60, 0x0342, 0x1F66 },
+	{ 0x1F60, 0x0345, 0x1FA0 }, { 0x1F61, 0x0300, 0x1F63 }, { 0x1F61, 0x0301, 0x1F65 },
+	{ 0x1F61, 0x0342, 0x1F67 }, { 0x1F61, 0x0345, 0x1FA1 }, { 0x1F62, 0x0345, 0x1FA2 },
+	{ 0x1F63, 0x0345, 0x1FA3 }, { 0x1F64, 0x0345, 0x1FA4 }, { 0x1F65, 0x0345, 0x1FA5 },
+	{ 0x1F66, 0x0345, 0x1FA6 }, { 0x1F67, 0x0345, 0x1FA7 }, { 0x1F68, 0x0300, 0x1F6A },
+	{ 0x1F68, 0x0301, 0x1F6C }, { 0x1F68, 0x0342, 0x1F6E }, { 0x1F68, 0x0345, 0x1FA8 },
+	{ 0x1F69, 0x0300, 0x1F6B }, { 0x1F69, 0x0301, 0x1F6D }, { 0x1F69, 0x0342, 0x1F6F },
+	{ 0x1F69, 0x0345, 0x1FA9 }, { 0x1F6A, 0x0345, 0x1FAA }, { 0x1F6B, 0x0345, 0x1FAB },
+	{ 0x1F6C, 0x0345, 0x1FAC }, { 0x1F6D, 0x0345, 0x1FAD }, { 0x1F6E, 0x0345, 0x1FAE },
+	{ 0x1F6F, 0x0345, 0x1FAF }, { 0x1F70, 0x0345, 0x1FB2 }, { 0x1F74, 0x0345, 0x1FC2 },
+	{ 0x1F7C, 0x0345, 0x1FF2 }, { 0x1FB6, 0x0345, 0x1FB7 }, { 0x1FBF, 0x0300, 0x1FCD },
+	{ 0x1FBF, 0x0301, 0x1FCE }, { 0x1FBF, 0x0342, 0x1FCF }, { 0x1FC6, 0x0345, 0x1FC7 },
+	{ 0x1FF6, 0x0345, 0x1FF7 }, { 0x1FFE, 0x0300, 0x1FDD }, { 0x1FFE, 0x0301, 0x1FDE },
+	{ 0x1FFE, 0x0342, 0x1FDF }, { 0x2190, 0x0338, 0x219A }, { 0x2192, 0x0338, 0x219B },
+	{ 0x2194, 0x0338, 0x21AE }, { 0x21D0, 0x0338, 0x21CD }, { 0x21D2, 0x0338, 0x21CF },
+	{ 0x21D4, 0x0338, 0x21CE }, { 0x2203, 0x0338, 0x2204 }, { 0x2208, 0x0338, 0x2209 },
+	{ 0x220B, 0x0338, 0x220C }, { 0x2223, 0x0338, 0x2224 }, { 0x2225, 0x0338, 0x2226 },
+	{ 0x223C, 0x0338, 0x2241 }, { 0x2243, 0x0338, 0x2244 }, { 0x2245, 0x0338, 0x2247 },
+	{ 0x2248, 0x0338, 0x2249 }, { 0x224D, 0x0338, 0x226D }, { 0x2261, 0x0338, 0x2262 },
+	{ 0x2264, 0x0338, 0x2270 }, { 0x2265, 0x0338, 0x2271 }, { 0x2272, 0x0338, 0x2274 },
+	{ 0x2273, 0x0338, 0x2275 }, { 0x2276, 0x0338, 0x2278 }, { 0x2277, 0x0338, 0x2279 },
+	{ 0x227A, 0x0338, 0x2280 }, { 0x227B, 0x0338, 0x2281 }, { 0x227C, 0x0338, 0x22E0 },
+	{ 0x227D, 0x0338, 0x22E1 }, { 0x2282, 0x0338, 0x2284 }, { 0x2283, 0x0338, 0x2285 },
+	{ 0x2286, 0x0338, 0x2288 }, { 0x2287, 0x0338, 0x2289 }, { 0x2291, 0x0338, 0x22E2 },
+	{ 0x2292, 0x0338, 0x22E3 }, { 0x22A2, 0x0338, 0x22AC }, { 0x22A8, 0x0338, 0x22AD },
+	{ 0x22A9, 0x0338, 0x22AE }, { 0x22AB, 0x0338, 0x22AF }, { 0x22B2, 0x0338, 0x22EA },
+	{ 0x22B3, 0x0338, 0x22EB }, { 0x22B4, 0x0338, 0x22EC }, { 0x22B5, 0x0338, 0x22ED },
+	{ 0x3046, 0x3099, 0x3094 }, { 0x304B, 0x3099, 0x304C }, { 0x304D, 0x3099, 0x304E },
+	{ 0x304F, 0x3099, 0x3050 }, { 0x3051, 0x3099, 0x3052 }, { 0x3053, 0x3099, 0x3054 },
+	{ 0x3055, 0x3099, 0x3056 }, { 0x3057, 0x3099, 0x3058 }, { 0x3059, 0x3099, 0x305A },
+	{ 0x305B, 0x3099, 0x305C }, { 0x305D, 0x3099, 0x305E }, { 0x305F, 0x3099, 0x3060 },
+	{ 0x3061, 0x3099, 0x3062 }, { 0x3064, 0x3099, 0x3065 }, { 0x3066, 0x3099, 0x3067 },
+	{ 0x3068, 0x3099, 0x3069 }, { 0x306F, 0x3099, 0x3070 }, { 0x306F, 0x309A, 0x3071 },
+	{ 0x3072, 0x3099, 0x3073 }, { 0x3072, 0x309A, 0x3074 }, { 0x3075, 0x3099, 0x3076 },
+	{ 0x3075, 0x309A, 0x3077 }, { 0x3078, 0x3099, 0x3079 }, { 0x3078, 0x309A, 0x307A },
+	{ 0x307B, 0x3099, 0x307C }, { 0x307B, 0x309A, 0x307D }, { 0x309D, 0x3099, 0x309E },
+	{ 0x30A6, 0x3099, 0x30F4 }, { 0x30AB, 0x3099, 0x30AC }, { 0x30AD, 0x3099, 0x30AE },
+	{ 0x30AF, 0x3099, 0x30B0 }, { 0x30B1, 0x3099, 0x30B2 }, { 0x30B3, 0x3099, 0x30B4 },
+	{ 0x30B5, 0x3099, 0x30B6 }, { 0x30B7, 0x3099, 0x30B8 }, { 0x30B9, 0x3099, 0x30BA },
+	{ 0x30BB, 0x3099, 0x30BC }, { 0x30BD, 0x3099, 0x30BE }, { 0x30BF, 0x3099, 0x30C0 },
+	{ 0x30C1, 0x3099, 0x30C2 }, { 0x30C4, 0x3099, 0x30C5 }, { 0x30C6, 0x3099, 0x30C7 },
+	{ 0x30C8, 0x3099, 0x30C9 }, { 0x30CF, 0x3099, 0x30D0 }, { 0x30CF, 0x309A, 0x30D1 },
+	{ 0x30D2, 0x3099, 0x30D3 }, { 0x30D2, 0x309A, 0x30D4 }, { 0x30D5, 0x3099, 0x30D6 },
+	{ 0x30D5, 0x309A, 0x30D7 }, { 0x30D8, 0x3099, 0x30D9 }, { 0x30D8, 0x309A, 0x30DA },
+	{ 0x30DB, 0x3099, 0x30DC }, { 0x30DB, 0x309A, 0x30DD }, { 0x30EF, 0x3099, 0x30F7 },
+	{ 0x30F0, 0x3099, 0x30F8 }, { 0x30F1, 0x3099, 0x30F9 }, { 0x30F2, 0x3099, 0x30FA },
+	{ 0x30FD, 0x3099, 0x30FE }, { 0x11099, 0x110BA, 0x1109A }, { 0x1109B, 0x110BA, 0x1109C },
+	{ 0x110A5, 0x110BA, 0x110AB }, { 0x11131, 0x11127, 0x1112E }, { 0x11132, 0x11127, 0x1112F },
+	{ 0x11347, 0x1133E, 0x1134B }, { 0x11347, 0x11357, 0x1134C }, { 0x114B9, 0x114B0, 0x114BC },
+	{ 0x114B9, 0x114BA, 0x114BB }, { 0x114B9, 0x114BD, 0x114BE }, { 0x115B8, 0x115AF, 0x115BA },
+	{ 0x115B9, 0x115AF, 0x115BB }, { 0x11935, 0x11930, 0x11938 },
+};
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * utf8.c - Code point access to UTF-8 string_t.
+ * Author: Saúl Valdelvira (2023)
+ *
+ * Each string_t can carry a sparse index with the byte offset of every
+ * UTF8_INDEX_STEP-th code point. It's built lazily, only as far as the
+ * requested code point, and the mutating functions of str.c truncate it
+ * at the first modified byte (see __str_modified), so appending to an
+ * indexed string keeps the index.
+ * A code point is counted for every byte that isn't a continuation byte
+ * (10xxxxxx), which is what makes counting vectorizable.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include "str.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h> // memcpy
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "util.h"
+#include "internal.h"
+
+#define INITIAL_MARKS 16
+
+static INLINE int __is_lead(char c){
+	return ((unsigned char)c & 0xC0) != 0x80;
+}
+
+static void __push_mark(struct utf8_index *idx, size_t offset){
+	if (idx->n_marks == idx->capacity){
+		idx->capacity = idx->capacity ? idx->capacity * 2 : INITIAL_MARKS;
+		idx->marks = realloc(idx->marks, idx->capacity * sizeof(size_t));
+		assert(idx->marks);
+	}
+	idx->marks[idx->n_marks++] = offset;
+}
+
+static INLINE void __count_lead(struct utf8_index *idx, size_t offset){
+	if (idx->n_chars == idx->n_marks * UTF8_INDEX_STEP)
+		__push_mark(idx, offset);
+	idx->n_chars++;
+}
+
+/*
+ * Indexes the string until it knows where code point [target] is,
+ * or the whole string if target is SIZE_MAX.
+ * The index is a cache, not part of the value of the string, so it's
+ * fine to update it through a const pointer.
+ */
+static struct utf8_index* __index(const string_t *str, size_t target){
+	string_t *s = (string_t*)str;
+	if (!s->utf8){
+		s->utf8 = calloc(1, sizeof(struct utf8_index));
+		assert(s->utf8);
+	}
+	struct utf8_index *idx = s->utf8;
+	const char *buf = str->buffer;
+	size_t i = idx->end;
+	while (i < str->length && (target == SIZE_MAX || idx->n_chars <= target)){
+#ifdef __SSE2__
+		/* Blocks without a mark in them just add their lead bytes.
+		 * As signed chars, continuation bytes are the ones below -64 */
+		const __m128i first_lead = _mm_set1_epi8(-64);
+		for (; i + 16 <= str->length; i += 16){
+			__m128i x = _mm_loadu_si128((const __m128i*)&buf[i]);
+			__m128i cont = _mm_cmplt_epi8(x, first_lead);
+			unsigned mask = ~_mm_movemask_epi8(cont) & 0xFFFF;
+			size_t n = __builtin_popcount(mask);
+			if (idx->n_chars + n > idx->n_marks * UTF8_INDEX_STEP)
+				break;
+			idx->n_chars += n;
+		}
+#endif
+		if (i < str->length){
+			if (__is_lead(buf[i]))
+				__count_lead(idx, i);
+			i++;
+		}
+	}
+	idx->end = i;
+	return idx;
+}
+
+/*
+ * Gets the byte offset of code point [index], which must be
+ * lower than the number of code points of the string.
+ */
+static size_t __offset_of(const string_t *str, size_t index){
+	struct utf8_index *idx = __index(str, index);
+	size_t k = index / UTF8_INDEX_STEP;
+	size_t i = idx->marks[k];
+	for (size_t left = index % UTF8_INDEX_STEP; left > 0; ){
+		i++;
+		if (__is_lead(str->buffer[i]))
+			left--;
+	}
+	return i;
+}
+
+size_t str_utf8_length(const string_t *str){
+	if (!str)
+		return 0;
+	return __index(str, SIZE_MAX)->n_chars;
+}
+
+long str_utf8_offset(const string_t *str, size_t index){
+	if (!str)
+		return -1;
+	size_t n_chars = __index(str, index)->n_chars;
+	if (index == n_chars)
+		return str->length;
+	if (index > n_chars)
+		return -2;
+	return __offset_of(str, index);
+}
+
+int32_t str_utf8_at(const string_t *str, size_t index){
+	long offset = str_utf8_offset(str, index);
+	if (offset < 0)
+		return offset;
+	if ((size_t)offset == str->length)
+		return -2;
+	const unsigned char *p = (const unsigned char*)&str->buffer[offset];
+	size_t avail = str->length - offset;
+	unsigned len;
+	int32_t cp;
+	if (p[0] < 0x80)
+		return p[0];
+	else if ((p[0] & 0xE0) == 0xC0){
+		len = 2;
+		cp = p[0] & 0x1F;
+	} else if ((p[0] & 0xF0) == 0xE0){
+		len = 3;
+		cp = p[0] & 0x0F;
+	} else if ((p[0] & 0xF8) == 0xF0){
+		len = 4;
+		cp = p[0] & 0x07;
+	} else {
+		return -3;
+	}
+	if (len > avail)
+		return -3;
+	for (unsigned j = 1; j < len; j++){
+		if ((p[j] & 0xC0) != 0x80)
+			return -3;
+		cp = cp << 6 | (p[j] & 0x3F);
+	}
+	return cp;
+}
+
+char* str_utf8_substring(const string_t *str, size_t start, size_t end){
+	if (!str || end < start)
+		return NULL;
+	long from = str_utf8_offset(str, start);
+	if (from == -2)
+		from = str->length;
+	long to = str_utf8_offset(str, end);
+	if (to == -2)
+		to = str->length;
+	size_t len = to - from;
+	char *substring = malloc((len + 1) * sizeof(char));
+	assert(substring);
+	memcpy(substring, &str->buffer[from], len * sizeof(char));
+	substring[len] = '\0';
+	return substring;
+}
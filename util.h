@@ -7,4 +7,21 @@
 #define INLINE inline
 #endif
 
+/*
+ * SIMD kernels are compiled with target attributes and picked at runtime,
+ * so the library doesn't need to be built with -mavx2 to use them.
+ * DISPATCH calls name_avx2 or name_ssse3 with the given arguments, or
+ * evaluates to fallback if the CPU supports neither.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define X86_DISPATCH
+#define SSSE3 __attribute__((target("ssse3")))
+#define AVX2  __attribute__((target("avx2")))
+#define DISPATCH(fallback, name, ...) \
+	(__builtin_cpu_supports("avx2")  ? name##_avx2(__VA_ARGS__)  : \
+	 __builtin_cpu_supports("ssse3") ? name##_ssse3(__VA_ARGS__) : (fallback))
+#else
+#define DISPATCH(fallback, name, ...) (fallback)
+#endif
+
 #endif
@@ -5,12 +5,18 @@
 #define _POSIX_C_SOURCE 200809L
 #include "wstr.h"
 #include <stdlib.h>
+#include <stdint.h>
 #include <assert.h>
 #include <string.h> // memcpy
 #include <stdarg.h>
 #include <time.h>
 #include <wchar.h>
+#include <wctype.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "util.h"
+#include "internal.h"
 
 #define INITIAL_SIZE 16
 #ifndef GROW_FACTOR
@@ -18,26 +24,131 @@
 #endif
 static_assert(GROW_FACTOR > 1, "");
 
-struct wstring {
-		wchar_t* buffer;
-		size_t   length;
-		size_t   buffer_size;
-};
+#define WIDE sizeof(wchar_t)
+
+/*
+ * Compact storage, in the style of PEP 393: a compact wstring_t stores
+ * each character in 1, 2 or 4 bytes, depending on the widest character
+ * it holds, and only widens when a wider one is added.
+ * Strings that aren't compact always have char_size == WIDE, so for them
+ * every helper below reduces to plain wchar_t operations.
+ */
 
+static INLINE unsigned __char_size_of(uint32_t c){
+	if (c < 0x100)
+		return 1;
+	return c < 0x10000 ? 2 : WIDE;
+}
+
+/*
+ * Since every char fits in char_size bytes iff all of them OR'ed
+ * together do, this loop vectorizes into a plain OR reduction.
+ */
+static unsigned __max_char_size(const wchar_t *src, size_t n){
+	uint32_t bits = 0;
+	for (size_t i = 0; i < n; i++)
+		bits |= (uint32_t)src[i];
+	return __char_size_of(bits);
+}
+
+static INLINE void* __at(const wstring_t *wstr, size_t i){
+	return (char*)wstr->buffer + i * wstr->char_size;
+}
+
+/*
+ * The buffer always has room for one more character than buffer_size,
+ * and the character at [length] is always L'\0'. Every function that
+ * changes the length must keep that invariant, so wstr_get_buffer never
+ * needs to modify the string.
+ */
 static void __resize_buffer(wstring_t *wstr, size_t new_size){
         assert(wstr);
         if (new_size == 0)
                 new_size = INITIAL_SIZE;
 	wstr->buffer_size = new_size;
-	wstr->buffer = realloc(wstr->buffer, wstr->buffer_size * sizeof(wchar_t));
+	wstr->buffer = realloc(wstr->buffer, (wstr->buffer_size + 1) * wstr->char_size);
 	assert(wstr->buffer);
 }
 
+/*
+ * Changes the size of the characters in the buffer.
+ * When growing, the characters are converted back to front, and when
+ * shrinking front to back, so that the conversion can be done in place.
+ */
+static void __convert(wstring_t *wstr, unsigned char_size){
+	size_t n = wstr->length + 1;
+	wstring_t old = *wstr;
+	if (char_size > wstr->char_size){
+		wstr->buffer = realloc(wstr->buffer, (wstr->buffer_size + 1) * char_size);
+		assert(wstr->buffer);
+		old.buffer = wstr->buffer;
+		wstr->char_size = char_size;
+		while (n-- > 0)
+			__wstr_put(wstr, n, __wstr_get(&old, n));
+	} else {
+		wstr->char_size = char_size;
+		for (size_t i = 0; i < n; i++)
+			__wstr_put(wstr, i, __wstr_get(&old, i));
+	}
+}
+
+static INLINE void __widen(wstring_t *wstr, unsigned char_size){
+	if (char_size > wstr->char_size)
+		__convert(wstr, char_size);
+}
+
+/* Makes sure the n characters of src fit in the buffer */
+static INLINE void __fit(wstring_t *wstr, const wchar_t *src, size_t n){
+	if (wstr->char_size < WIDE)
+		__widen(wstr, __max_char_size(src, n));
+}
+
+static INLINE void __fit_char(wstring_t *wstr, wchar_t c){
+	if (wstr->char_size < WIDE)
+		__widen(wstr, __char_size_of(c));
+}
+
+static void __store(wstring_t *wstr, size_t index, const wchar_t *src, size_t n){
+	switch (wstr->char_size){
+	case 1:
+		for (size_t i = 0; i < n; i++)
+			((uint8_t*)wstr->buffer)[index + i] = src[i];
+		break;
+	case 2:
+		for (size_t i = 0; i < n; i++)
+			((uint16_t*)wstr->buffer)[index + i] = src[i];
+		break;
+	default:
+		memcpy(__at(wstr, index), src, n * sizeof(wchar_t));
+	}
+}
+
+/* Moves n characters from src to dst, inside the buffer */
+static INLINE void __move(wstring_t *wstr, size_t dst, size_t src, size_t n){
+	memmove(__at(wstr, dst), __at(wstr, src), n * wstr->char_size);
+}
+
+/* Returns a malloc'd wchar_t copy of the range [start, start + n) */
+static wchar_t* __copy_out(const wstring_t *wstr, size_t start, size_t n){
+	wchar_t *dst = malloc((n + 1) * sizeof(wchar_t));
+	assert(dst);
+	if (wstr->char_size == WIDE){
+		memcpy(dst, __at(wstr, start), n * sizeof(wchar_t));
+	} else {
+		for (size_t i = 0; i < n; i++)
+			dst[i] = __wstr_get(wstr, start + i);
+	}
+	dst[n] = L'\0';
+	return dst;
+}
+
 #define __wstr_init(initial_size) \
 	wstring_t *wstr = malloc(sizeof(wstring_t)); \
 	assert(wstr); \
         memset(wstr, 0, sizeof(wstring_t)); \
+	wstr->char_size = WIDE; \
 	__resize_buffer(wstr, initial_size); \
+	__wstr_put(wstr, 0, L'\0'); \
 	return wstr;
 
 wstring_t* wstr_empty(void){
@@ -77,6 +188,27 @@ wstring_t* wstr_from_cstr(const char *src, unsigned n){
 	return wstr;
 }
 
+void wstr_compact(wstring_t *wstr){
+	if (!wstr)
+		return;
+	uint32_t bits = 0;
+	for (size_t i = 0; i < wstr->length; i++)
+		bits |= (uint32_t)__wstr_get(wstr, i);
+	unsigned char_size = __char_size_of(bits);
+	if (char_size < wstr->char_size){
+		__convert(wstr, char_size);
+		__resize_buffer(wstr, wstr->length);
+	}
+	wstr->compact = 1;
+	__wstr_modified(wstr);
+}
+
+unsigned wstr_char_size(const wstring_t *wstr){
+	if (!wstr)
+		return 0;
+	return wstr->char_size;
+}
+
 void wstr_reserve(wstring_t *wstr, unsigned n){
 	if (wstr && wstr->buffer_size < n)
 		__resize_buffer(wstr, n);
@@ -95,28 +227,56 @@ int wstr_concat_cwstr(wstring_t *wstr, const wchar_t *cat, unsigned n){
 	if (!wstr || !cat)
 		return -1;
 	size_t len = __wstrnlen(cat, n);
+	__fit(wstr, cat, len);
 	resize_if_needed(wstr, len);
-	memcpy(&wstr->buffer[wstr->length], cat, len * sizeof(wchar_t));
-	wstr->length += len;
+	__store(wstr, wstr->length, cat, len);
+	__wstr_set_length(wstr, wstr->length + len);
 	return 1;
 }
 
+/*
+ * Converts the chars of a cstring the same way an assignment from
+ * char to wchar_t would.
+ */
+static void __store_cstr(wstring_t *wstr, size_t index, const char *src, size_t n){
+	if (wstr->char_size < WIDE){
+		uint32_t bits = 0;
+		for (size_t i = 0; i < n; i++)
+			bits |= (uint32_t)(wchar_t)src[i];
+		__widen(wstr, __char_size_of(bits));
+	}
+	for (size_t i = 0; i < n; i++)
+		__wstr_put(wstr, index + i, src[i]);
+}
+
 int wstr_concat_cstr(wstring_t *wstr, const char *cat, unsigned n){
 	if (!wstr || !cat)
 		return -1;
 	size_t len = strnlen(cat, n);
 	resize_if_needed(wstr, len);
-	wchar_t *start = &wstr->buffer[wstr->length];
-	while (--n > 0 && *cat)
-		*start++ = *cat++;
-	wstr->length += len;
+	__store_cstr(wstr, wstr->length, cat, len);
+	__wstr_set_length(wstr, wstr->length + len);
 	return 1;
 }
 
 int wstr_concat_wstr(wstring_t *wstr, wstring_t *cat){
 	if (!wstr || !cat)
 		return -1;
-	return wstr_concat_cwstr(wstr, cat->buffer, cat->length);
+	size_t len = cat->length;
+	if (cat->char_size == WIDE)
+		__fit(wstr, cat->buffer, len);
+	else
+		__widen(wstr, cat->char_size);
+	/* cat is read after the resize, in case it's wstr itself */
+	resize_if_needed(wstr, len);
+	if (cat->char_size == wstr->char_size){
+		memcpy(__at(wstr, wstr->length), cat->buffer, len * cat->char_size);
+	} else {
+		for (size_t i = 0; i < len; i++)
+			__wstr_put(wstr, wstr->length + i, __wstr_get(cat, i));
+	}
+	__wstr_set_length(wstr, wstr->length + len);
+	return 1;
 }
 
 int wstr_push_char(wstring_t *wstr, wchar_t c){
@@ -134,22 +294,21 @@ int wstr_remove_at(wstring_t *wstr, unsigned index){
 		return -1;
 	if (index >= wstr->length)
 		return -2;
-	if (index < wstr->length - 1)
-		memcpy(&wstr->buffer[index], &wstr->buffer[index + 1], (wstr->length - index - 1) * sizeof(wchar_t));
-	wstr->length--;
+	__move(wstr, index, index + 1, wstr->length - index - 1);
+	__wstr_set_length(wstr, wstr->length - 1);
 	return 1;
 }
 
 int wstr_remove_range(wstring_t *wstr, unsigned start, unsigned end){
 	if (!wstr)
 		return -1;
-	if (end < start)
+	if (end < start || start > wstr->length)
 		return -2;
 	if (end > wstr->length)
 		end = wstr->length;
 	size_t len = wstr->length - end;
-	memmove(&wstr->buffer[start], &wstr->buffer[end], len * sizeof(wchar_t));
-	wstr->length -= end - start;
+	__move(wstr, start, end, len);
+	__wstr_set_length(wstr, wstr->length - (end - start));
 	return 1;
 }
 
@@ -158,7 +317,7 @@ wchar_t wstr_get_at(const wstring_t *wstr, unsigned index){
 		return -1;
 	else if (index >= wstr->length)
 		return -2;
-	return wstr->buffer[index];
+	return __wstr_get(wstr, index);
 }
 
 int wstr_set_at(wstring_t *wstr, unsigned index, wchar_t c){
@@ -166,7 +325,10 @@ int wstr_set_at(wstring_t *wstr, unsigned index, wchar_t c){
 		return -1;
 	else if (index >= wstr->length)
 		return -2;
-	return wstr->buffer[index] = c;
+	__fit_char(wstr, c);
+	__wstr_put(wstr, index, c);
+	__wstr_modified(wstr);
+	return c;
 }
 
 int wstr_insert_cwstr(wstring_t *wstr, const wchar_t *insert, unsigned n, unsigned index){
@@ -175,10 +337,11 @@ int wstr_insert_cwstr(wstring_t *wstr, const wchar_t *insert, unsigned n, unsign
 	if (index > wstr->length)
 		return -2;
 	size_t len = __wstrnlen(insert, n);
+	__fit(wstr, insert, len);
 	resize_if_needed(wstr, len);
-	memmove(&wstr->buffer[index + len], &wstr->buffer[index], (wstr->length - index) * sizeof(wchar_t));
-	memcpy(&wstr->buffer[index], insert, len * sizeof(wchar_t));
-	wstr->length += len;
+	__move(wstr, index + len, index, wstr->length - index);
+	__store(wstr, index, insert, len);
+	__wstr_set_length(wstr, wstr->length + len);
 	return 1;
 }
 
@@ -189,9 +352,9 @@ int wstr_insert_cstr(wstring_t *wstr, const char *insert, unsigned n, unsigned i
 		return -2;
 	size_t len = strnlen(insert, n);
 	resize_if_needed(wstr, len);
-	memmove(&wstr->buffer[index + len], &wstr->buffer[index], (wstr->length - index) * sizeof(char));
-	memcpy(&wstr->buffer[index], insert, len * sizeof(char));
-	wstr->length += len;
+	__move(wstr, index + len, index, wstr->length - index);
+	__store_cstr(wstr, index, insert, len);
+	__wstr_set_length(wstr, wstr->length + len);
 	return 1;
 }
 
@@ -202,24 +365,30 @@ int wstr_insert(wstring_t *wstr, wchar_t c, unsigned index){
 wchar_t* wstr_to_cwstr(const wstring_t *wstr){
 	if (!wstr)
 		return NULL;
-	wchar_t *cwstr = malloc((wstr->length + 1) * sizeof(wchar_t));
-	memcpy(cwstr, wstr->buffer, wstr->length * sizeof(wchar_t));
-	cwstr[wstr->length] = '\0';
-	return cwstr;
+	return __copy_out(wstr, 0, wstr->length);
 }
 
-static void __add_null_term(wstring_t *wstr) {
-        assert(wstr);
-	if (wstr->length == wstr->buffer_size)
-		__resize_buffer(wstr, wstr->buffer_size * GROW_FACTOR);
-	wstr->buffer[wstr->length] = '\0';
-}
-
-const wchar_t* wstr_get_buffer(wstring_t *wstr){
+/*
+ * The wide copy of a compact string is a cache, not part of its value,
+ * so it's fine to build it through a const pointer. Concurrent readers
+ * may both build one; the first to publish it wins and the other
+ * frees its copy.
+ */
+const wchar_t* wstr_get_buffer(const wstring_t *wstr){
 	if (!wstr)
 		return NULL;
-        __add_null_term(wstr);
-	return wstr->buffer;
+	if (wstr->char_size == WIDE)
+		return wstr->buffer;
+	wchar_t **cache = &((wstring_t*)wstr)->wide;
+	wchar_t *wide = __atomic_load_n(cache, __ATOMIC_ACQUIRE);
+	if (!wide){
+		wchar_t *copy = __copy_out(wstr, 0, wstr->length);
+		if (__atomic_compare_exchange_n(cache, &wide, copy, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			wide = copy;
+		else
+			free(copy);
+	}
+	return wide;
 }
 
 wchar_t* wstr_substring(wstring_t *wstr, unsigned start, unsigned end){
@@ -227,20 +396,18 @@ wchar_t* wstr_substring(wstring_t *wstr, unsigned start, unsigned end){
 		return NULL;
 	if (end > wstr->length)
 		end = wstr->length;
-	size_t len = end - start;
-	wchar_t *substring = malloc((len + 1) * sizeof(wchar_t));
-	assert(substring);
-	memcpy(substring, &wstr->buffer[start], len * sizeof(wchar_t));
-	substring[len] = '\0';
-	return substring;
+	return __copy_out(wstr, start, end - start);
 }
 
 wstring_t* wstr_dup(wstring_t *wstr){
 	if (!wstr)
 		return NULL;
 	wstring_t *dup = wstr_init(wstr->length);
-	memcpy(dup->buffer, wstr->buffer, wstr->length * sizeof(wchar_t));
-		dup->length = wstr->length;
+	dup->char_size = wstr->char_size;
+	dup->compact = wstr->compact;
+	__resize_buffer(dup, wstr->length);
+	memcpy(dup->buffer, wstr->buffer, (wstr->length + 1) * wstr->char_size);
+	dup->length = wstr->length;
 	return dup;
 }
 
@@ -263,25 +430,19 @@ wchar_t* wstr_tok(wstring_t *wstr, wchar_t *tokens){
 	if (!curr_str || !tokens || pos == curr_str->length)
 		return NULL;
 	for (size_t i = pos; i < curr_str->length; i++){
+		wchar_t c = __wstr_get(curr_str, i);
 		for (wchar_t *t = tokens; *t != '\0'; t++){
-			if (curr_str->buffer[i] == *t){
-				size_t len = i - pos;
-				prev_tok = malloc((len + 1) * sizeof(wchar_t));
-				memcpy(prev_tok, &curr_str->buffer[pos], len * sizeof(wchar_t));
-				prev_tok[len] = '\0';
+			if (c == *t){
+				prev_tok = __copy_out(curr_str, pos, i - pos);
 				pos = i + 1;
 				return prev_tok;
 			}
 		}
 	}
-	size_t len = curr_str->length - pos;
-	prev_tok = malloc((len + 1) * sizeof(wchar_t));
-	memcpy(prev_tok, &curr_str->buffer[pos], len * sizeof(wchar_t));
-	prev_tok[len] = L'\0';
+	prev_tok = __copy_out(curr_str, pos, curr_str->length - pos);
 	pos = curr_str->length;
 	return prev_tok;
 }
-
 wchar_t** wstr_split(wstring_t *wstr, wchar_t *delim){
 	if (!wstr || !delim)
 		return NULL;
@@ -314,20 +475,54 @@ wchar_t** wstr_split(wstring_t *wstr, wchar_t *delim){
 	return split;
 }
 
+/*
+ * Same loop for every char_size. The chars of substr that don't fit
+ * in T simply never match.
+ */
+#define __find(T, wstr, substr, start_at) do { \
+	const T *buf = (wstr)->buffer; \
+	for (size_t i = (start_at); i < (wstr)->length; i++){ \
+		const wchar_t *c = (substr); \
+		for (size_t j = i; j < (wstr)->length; j++){ \
+			if (*c != (wchar_t)buf[j]) \
+				break; \
+			c++; \
+			if (*c == L'\0') \
+				return i; \
+		} \
+	} \
+} while (0)
+
 int wstr_find_substring(wstring_t *wstr, const wchar_t *substr, unsigned start_at){
 	if (!wstr || !substr)
 		return -2;
 	if (start_at >= wstr->length)
 		return -3;
-	for (size_t i = start_at; i < wstr->length; i++){
-		const wchar_t *c = substr;
-		for (size_t j = i; j < wstr->length; j++){
-			if (*c != wstr->buffer[j])
-				break;
-			c++;
-			if (*c == L'\0')
-                                return i;
+	switch (wstr->char_size){
+	case 1:
+		if (substr[0] == L'\0'){
+			__find(uint8_t, wstr, substr, start_at);
+			break;
+		}
+		if ((uint32_t)substr[0] >= 0x100)
+			return -1;
+		/* memchr skips straight to the candidates */
+		for (const uint8_t *p = __at(wstr, start_at), *end = __at(wstr, wstr->length);
+		     (p = memchr(p, substr[0], end - p)) != NULL; p++){
+			size_t i = p - (const uint8_t*)wstr->buffer;
+			size_t j = 1;
+			while (substr[j] != L'\0' && i + j < wstr->length
+			       && substr[j] == (wchar_t)p[j])
+				j++;
+			if (substr[j] == L'\0')
+				return i;
 		}
+		break;
+	case 2:
+		__find(uint16_t, wstr, substr, start_at);
+		break;
+	default:
+		__find(wchar_t, wstr, substr, start_at);
 	}
 	return -1;
 }
@@ -349,8 +544,12 @@ int wstr_replace(wstring_t *wstr, const wchar_t *substr, const wchar_t *replacem
 int wstr_transform(wstring_t *wstr, wchar_t(*func)(wchar_t)){
 	if (!wstr || !func)
 		return -1;
-	for (size_t i = 0; i < wstr->length; i++)
-		wstr->buffer[i] = func(wstr->buffer[i]);
+	for (size_t i = 0; i < wstr->length; i++){
+		wchar_t c = func(__wstr_get(wstr, i));
+		__fit_char(wstr, c);
+		__wstr_put(wstr, i, c);
+	}
+	__wstr_modified(wstr);
 	return 1;
 }
 
@@ -361,7 +560,8 @@ void wstr_shrink(wstring_t *wstr){
 
 wchar_t* wstr_into_cwstr(wstring_t *wstr) {
         if (!wstr) return NULL;
-        __add_null_term(wstr);
+        __widen(wstr, WIDE);
+        __wstr_modified(wstr);
         wstr_shrink(wstr);
         wchar_t *buf = wstr->buffer;
         wstr->buffer = NULL;
@@ -370,30 +570,226 @@ wchar_t* wstr_into_cwstr(wstring_t *wstr) {
 
 wchar_t* wstr_cloned_cwstr(wstring_t *wstr) {
         if (!wstr) return NULL;
-        wchar_t *result = malloc((wstr->length + 1) * sizeof(wchar_t));
-        memcpy(result, wstr->buffer, wstr->length * sizeof(wchar_t));
-        result[wstr->length] = L'\0';
-        return result;
-}
-
-int wstr_cmp_cwstr(const wstring_t *wstr, const wchar_t *cwstr) {
-        if (!wstr || !cwstr) return 0;
-        for (size_t i = 0; i < wstr->length; i++) {
-                int c = wstr->buffer[i] - cwstr[i];
-                if (c != 0)
-                        return c;
-        }
-        return 0;
+        return __copy_out(wstr, 0, wstr->length);
+}
+
+wstr_view_t wstr_as_view(const wstring_t *wstr){
+	if (!wstr)
+		return (wstr_view_t){ .buf = L"", .len = 0 };
+	return (wstr_view_t){ .buf = wstr_get_buffer(wstr), .len = wstr->length };
+}
+
+/*
+ * Characters of char_size bytes each, from a wstring_t or a wchar_t
+ * view. The comparisons read compact strings through it, so they
+ * never need their wide copy.
+ */
+struct span {
+	const void *buf;
+	size_t len;
+	unsigned char_size;
+};
+
+static INLINE struct span __wstr_span(const wstring_t *wstr){
+	if (!wstr)
+		return (struct span){ .buf = L"", .len = 0, .char_size = WIDE };
+	return (struct span){ .buf = wstr->buffer, .len = wstr->length, .char_size = wstr->char_size };
+}
+
+static INLINE struct span __view_span(wstr_view_t view){
+	return (struct span){ .buf = view.buf, .len = view.len, .char_size = WIDE };
+}
+
+static INLINE struct span __cwstr_span(const wchar_t *cwstr){
+	if (!cwstr)
+		return (struct span){ .buf = L"", .len = 0, .char_size = WIDE };
+	return (struct span){ .buf = cwstr, .len = wcslen(cwstr), .char_size = WIDE };
+}
+
+static INLINE wint_t __wlower(wchar_t c){
+	if (c < 128)
+		return (c >= L'A' && c <= L'Z') ? c | 0x20 : c;
+	return towlower(c);
+}
+
+/*
+ * Compares n wchar_t of a and b, ignoring case.
+ * Runs of identical characters are skipped 4 at a time with SSE2,
+ * so towlower only runs on the blocks that actually differ.
+ */
+static int __casecmp_n(const wchar_t *a, const wchar_t *b, size_t n){
+	size_t i = 0;
+	while (i < n){
+#if defined(__SSE2__) && WCHAR_MAX == 0x7fffffff
+		for (; i + 4 <= n; i += 4){
+			__m128i x = _mm_loadu_si128((const __m128i*)&a[i]);
+			__m128i y = _mm_loadu_si128((const __m128i*)&b[i]);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(x, y)) != 0xFFFF)
+				break;
+		}
+		size_t end = i + 4 < n ? i + 4 : n;
+#else
+		size_t end = n;
+#endif
+		for (; i < end; i++){
+			if (a[i] == b[i])
+				continue;
+			wint_t ca = __wlower(a[i]), cb = __wlower(b[i]);
+			if (ca != cb)
+				return ca < cb ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+/* Compares the first n characters of a and b */
+static int __cmp_n(struct span a, struct span b, size_t n, int nocase){
+	if (a.char_size == WIDE && b.char_size == WIDE)
+		return nocase ? __casecmp_n(a.buf, b.buf, n) : wmemcmp(a.buf, b.buf, n);
+	if (!nocase && a.char_size == 1 && b.char_size == 1){
+		int c = memcmp(a.buf, b.buf, n);
+		return (c > 0) - (c < 0);
+	}
+	for (size_t i = 0; i < n; i++){
+		wchar_t ca = __wchar_at(a.buf, i, a.char_size);
+		wchar_t cb = __wchar_at(b.buf, i, b.char_size);
+		if (ca == cb)
+			continue;
+		if (!nocase)
+			return ca < cb ? -1 : 1;
+		wint_t la = __wlower(ca), lb = __wlower(cb);
+		if (la != lb)
+			return la < lb ? -1 : 1;
+	}
+	return 0;
+}
+
+static int __cmp(struct span a, struct span b, int nocase){
+	size_t min = a.len < b.len ? a.len : b.len;
+	int c = __cmp_n(a, b, min, nocase);
+	if (c != 0)
+		return c;
+	return (a.len > b.len) - (a.len < b.len);
+}
+
+static INLINE int __eq(struct span a, struct span b, int nocase){
+	if (a.len != b.len)
+		return 0;
+	if (!nocase && a.char_size == b.char_size)
+		return memcmp(a.buf, b.buf, a.len * a.char_size) == 0;
+	return __cmp_n(a, b, a.len, nocase) == 0;
+}
+
+static INLINE int __starts_with(struct span s, struct span prefix, int nocase){
+	if (prefix.len > s.len)
+		return 0;
+	s.len = prefix.len;
+	return __eq(s, prefix, nocase);
+}
+
+static INLINE int __ends_with(struct span s, struct span suffix, int nocase){
+	if (suffix.len > s.len)
+		return 0;
+	s.buf = (const char*)s.buf + (s.len - suffix.len) * s.char_size;
+	s.len = suffix.len;
+	return __eq(s, suffix, nocase);
+}
+
+int wstr_cmp(const wstring_t *wstr, const wstring_t *other){
+	return __cmp(__wstr_span(wstr), __wstr_span(other), 0);
+}
+
+int wstr_cmp_cwstr(const wstring_t *wstr, const wchar_t *cwstr){
+	return __cmp(__wstr_span(wstr), __cwstr_span(cwstr), 0);
+}
+
+int wstr_cmp_view(const wstring_t *wstr, wstr_view_t view){
+	return __cmp(__wstr_span(wstr), __view_span(view), 0);
+}
+
+int wstr_casecmp(const wstring_t *wstr, const wstring_t *other){
+	return __cmp(__wstr_span(wstr), __wstr_span(other), 1);
+}
+
+int wstr_casecmp_cwstr(const wstring_t *wstr, const wchar_t *cwstr){
+	return __cmp(__wstr_span(wstr), __cwstr_span(cwstr), 1);
+}
+
+int wstr_casecmp_view(const wstring_t *wstr, wstr_view_t view){
+	return __cmp(__wstr_span(wstr), __view_span(view), 1);
+}
+
+int wstr_eq(const wstring_t *wstr, const wstring_t *other){
+	return __eq(__wstr_span(wstr), __wstr_span(other), 0);
+}
+
+int wstr_eq_cwstr(const wstring_t *wstr, const wchar_t *cwstr){
+	return __eq(__wstr_span(wstr), __cwstr_span(cwstr), 0);
+}
+
+int wstr_eq_view(const wstring_t *wstr, wstr_view_t view){
+	return __eq(__wstr_span(wstr), __view_span(view), 0);
+}
+
+int wstr_caseeq(const wstring_t *wstr, const wstring_t *other){
+	return __eq(__wstr_span(wstr), __wstr_span(other), 1);
+}
+
+int wstr_caseeq_cwstr(const wstring_t *wstr, const wchar_t *cwstr){
+	return __eq(__wstr_span(wstr), __cwstr_span(cwstr), 1);
+}
+
+int wstr_caseeq_view(const wstring_t *wstr, wstr_view_t view){
+	return __eq(__wstr_span(wstr), __view_span(view), 1);
+}
+
+int wstr_starts_with(const wstring_t *wstr, const wchar_t *prefix){
+	return __starts_with(__wstr_span(wstr), __cwstr_span(prefix), 0);
+}
+
+int wstr_starts_with_view(const wstring_t *wstr, wstr_view_t prefix){
+	return __starts_with(__wstr_span(wstr), __view_span(prefix), 0);
+}
+
+int wstr_ends_with(const wstring_t *wstr, const wchar_t *suffix){
+	return __ends_with(__wstr_span(wstr), __cwstr_span(suffix), 0);
+}
+
+int wstr_ends_with_view(const wstring_t *wstr, wstr_view_t suffix){
+	return __ends_with(__wstr_span(wstr), __view_span(suffix), 0);
+}
+
+int wstr_case_starts_with(const wstring_t *wstr, const wchar_t *prefix){
+	return __starts_with(__wstr_span(wstr), __cwstr_span(prefix), 1);
+}
+
+int wstr_case_starts_with_view(const wstring_t *wstr, wstr_view_t prefix){
+	return __starts_with(__wstr_span(wstr), __view_span(prefix), 1);
+}
+
+int wstr_case_ends_with(const wstring_t *wstr, const wchar_t *suffix){
+	return __ends_with(__wstr_span(wstr), __cwstr_span(suffix), 1);
+}
+
+int wstr_case_ends_with_view(const wstring_t *wstr, wstr_view_t suffix){
+	return __ends_with(__wstr_span(wstr), __view_span(suffix), 1);
 }
 
 void wstr_clear(wstring_t *wstr){
-	if (wstr)
-		wstr->length = 0;
+	if (wstr){
+		/* An empty compact string goes back to 1 byte chars */
+		if (wstr->compact && wstr->char_size > 1){
+			wstr->buffer_size = (wstr->buffer_size + 1) * wstr->char_size - 1;
+			wstr->char_size = 1;
+		}
+		__wstr_set_length(wstr, 0);
+	}
 }
 
 static INLINE void __wstr__free(wstring_t *wstr) {
 	if (wstr){
 		free(wstr->buffer);
+		free(wstr->wide);
 		free(wstr);
 	}
 }
@@ -9,8 +9,21 @@
 
 #include <stddef.h> // size_t, wchar_t
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef struct wstring wstring_t;
 
+/**
+ * Non-owning view of a sequence of wchar_t.
+ * @note The buffer is not necessarily NULL terminated.
+ */
+typedef struct {
+        const wchar_t *buf;
+        size_t         len;
+} wstr_view_t;
+
 /**
  * Builds an empty wstring_t
  */
@@ -35,6 +48,23 @@ wstring_t* wstr_from_cstr(const char *src, unsigned n);
  */
 void wstr_reserve(wstring_t *wstr, unsigned n);
 
+/**
+ * Switches the wstring_t to compact storage, where each character takes
+ * 1, 2 or sizeof(wchar_t) bytes, depending on the widest one in the
+ * string (Latin-1, UCS-2 or UCS-4). A compact string widens itself when
+ * a wider character is added, and calling this again narrows it back.
+ * Apart from wstr_get_buffer (see below), all the functions behave
+ * the same on compact strings.
+ * @note To build a compact string from the start: wstr_compact(wstr_empty())
+ */
+void wstr_compact(wstring_t *wstr);
+
+/**
+ * Returns the number of bytes used to store each character
+ * (always sizeof(wchar_t) unless the string is compact)
+ */
+unsigned wstr_char_size(const wstring_t *wstr);
+
 /**
  * Concatenates the given cwstring at the end of the wstring_t
  * @param n max length of cat
@@ -70,7 +100,10 @@ int wstr_pop(wstring_t *wstr);
 int wstr_remove_at(wstring_t *str, unsigned index);
 
 /**
- * Removes the range [start, end) from the wstring_t
+ * Removes the range [start, end) from the wstring_t.
+ * end is clamped to the length of the string.
+ * @return 1 on success, -1 if wstr is NULL,
+ *         -2 if end < start or start is out of bounds
 */
 int wstr_remove_range(wstring_t *wstr, unsigned start, unsigned end);
 
@@ -105,9 +138,14 @@ wchar_t* wstr_to_cwstr(const wstring_t *wstr);
 
 /**
  * Returns a pointer to the internal buffer of the wstring_t.
- * A null terminator will be appended.
+ * The buffer is always NULL terminated.
+ * If the string is compact and narrower than wchar_t, the first call
+ * builds a wchar_t copy of it, which is kept until the string changes.
+ * The copy is published atomically, so it's safe to call from
+ * concurrent readers.
+ * @note The pointer is invalidated by any operation that modifies the wstring_t
  */
-const wchar_t* wstr_get_buffer(wstring_t *wstr);
+const wchar_t* wstr_get_buffer(const wstring_t *wstr);
 
 /**
  * Returns a substring of the wstring_t in the range [start, end)
@@ -119,7 +157,101 @@ wchar_t* wstr_substring(wstring_t *wstr, unsigned start, unsigned end);
  */
 wstring_t* wstr_dup(wstring_t *wstr);
 
+/**
+ * Returns a view of the contents of the wstring_t.
+ * The buffer of the view comes from wstr_get_buffer.
+ * @note The view is invalidated by any operation that modifies the wstring_t
+ */
+wstr_view_t wstr_as_view(const wstring_t *wstr);
+
+/**
+ * Compares two wide strings lexicographically, like wmemcmp, with the
+ * shorter string ordering first on a common prefix.
+ * A NULL argument is treated as an empty string.
+ * @return <0, 0 or >0 if wstr is less, equal or greater than other
+ */
+int wstr_cmp(const wstring_t *wstr, const wstring_t *other);
 int wstr_cmp_cwstr(const wstring_t *wstr, const wchar_t *cwstr);
+int wstr_cmp_view(const wstring_t *wstr, wstr_view_t view);
+
+/**
+ * Same as wstr_cmp, but ignoring case (see towlower).
+ */
+int wstr_casecmp(const wstring_t *wstr, const wstring_t *other);
+int wstr_casecmp_cwstr(const wstring_t *wstr, const wchar_t *cwstr);
+int wstr_casecmp_view(const wstring_t *wstr, wstr_view_t view);
+
+/**
+ * Checks if two wide strings are equal.
+ * The lengths are checked first, so this is cheaper than wstr_cmp.
+ * @return 1 if equal, 0 if not
+ */
+int wstr_eq(const wstring_t *wstr, const wstring_t *other);
+int wstr_eq_cwstr(const wstring_t *wstr, const wchar_t *cwstr);
+int wstr_eq_view(const wstring_t *wstr, wstr_view_t view);
+
+/**
+ * Same as wstr_eq, but ignoring case (see towlower).
+ */
+int wstr_caseeq(const wstring_t *wstr, const wstring_t *other);
+int wstr_caseeq_cwstr(const wstring_t *wstr, const wchar_t *cwstr);
+int wstr_caseeq_view(const wstring_t *wstr, wstr_view_t view);
+
+/**
+ * Checks if the wstring_t starts with the given prefix
+ * @return 1 if it does, 0 if not
+ */
+int wstr_starts_with(const wstring_t *wstr, const wchar_t *prefix);
+int wstr_starts_with_view(const wstring_t *wstr, wstr_view_t prefix);
+
+/**
+ * Checks if the wstring_t ends with the given suffix
+ * @return 1 if it does, 0 if not
+ */
+int wstr_ends_with(const wstring_t *wstr, const wchar_t *suffix);
+int wstr_ends_with_view(const wstring_t *wstr, wstr_view_t suffix);
+
+/**
+ * Same as wstr_starts_with and wstr_ends_with, but ignoring case.
+ */
+int wstr_case_starts_with(const wstring_t *wstr, const wchar_t *prefix);
+int wstr_case_starts_with_view(const wstring_t *wstr, wstr_view_t prefix);
+int wstr_case_ends_with(const wstring_t *wstr, const wchar_t *suffix);
+int wstr_case_ends_with_view(const wstring_t *wstr, wstr_view_t suffix);
+
+/**
+ * Computes the Levenshtein distance between two wstring_ts.
+ * @return the distance, or -1 if a or b are NULL
+ */
+long wstr_edit_distance(const wstring_t *a, const wstring_t *b);
+
+/**
+ * Same as wstr_edit_distance, but gives up as soon as the distance is
+ * known to be greater than k.
+ * @return the distance, -1 if a or b are NULL, or -2 if it's greater than k
+ */
+long wstr_edit_distance_max(const wstring_t *a, const wstring_t *b, size_t k);
+
+/**
+ * Computes the distance between query and each of the n candidates,
+ * as wstr_edit_distance_max does, into out[i].
+ * @param k the bound, or SIZE_MAX for no bound
+ * @return 1 on success, -1 if query, candidates or out are NULL
+ */
+int wstr_edit_distance_batch(const wstring_t *query, wstring_t *const *candidates, size_t n, size_t k, long *out);
+
+/**
+ * Sorts an array of wstring_t in ascending order (see wstr_cmp).
+ * NULL elements are treated as empty strings.
+ */
+void wstr_sort(wstring_t **arr, size_t n);
+
+/**
+ * Same as wstr_sort, but for big arrays the work is split
+ * between n_threads threads.
+ * @param n_threads number of threads to use. If 0, one per online CPU.
+ */
+void wstr_sort_parallel(wstring_t **arr, size_t n, unsigned n_threads);
 
 /**
  * Returns the length of the wstring_t
@@ -157,6 +289,52 @@ wchar_t** wstr_split(wstring_t *wstr, wchar_t *delim);
  */
 int wstr_find_substring(wstring_t *wstr, const wchar_t *substr, unsigned start_at);
 
+/**
+ * Finds the first character, starting at index [start_at],
+ * that is any of the characters in chars
+ * @return Index of the character, -1 if there isn't any,
+ *         -2 if wstr or chars are NULL, -3 if start_at is out of bounds
+ */
+int wstr_find_any_of(const wstring_t *wstr, const wchar_t *chars, unsigned start_at);
+
+/**
+ * Finds the first character, starting at index [start_at],
+ * that is none of the characters in chars
+ * @return Same as wstr_find_any_of
+ */
+int wstr_find_not_of(const wstring_t *wstr, const wchar_t *chars, unsigned start_at);
+
+/**
+ * @return the number of characters, starting at index [start_at],
+ *         that are in accept
+ */
+size_t wstr_span(const wstring_t *wstr, const wchar_t *accept, unsigned start_at);
+
+/**
+ * @return the number of characters, starting at index [start_at],
+ *         that aren't in reject
+ */
+size_t wstr_cspan(const wstring_t *wstr, const wchar_t *reject, unsigned start_at);
+
+/**
+ * Removes the leading and trailing characters that are in chars,
+ * or whitespace if chars is NULL
+ * @note The buffer isn't shrinked
+ */
+int wstr_trim(wstring_t *wstr, const wchar_t *chars);
+
+/**
+ * Removes the leading characters that are in chars,
+ * or whitespace if chars is NULL
+ */
+int wstr_ltrim(wstring_t *wstr, const wchar_t *chars);
+
+/**
+ * Removes the trailing characters that are in chars,
+ * or whitespace if chars is NULL
+ */
+int wstr_rtrim(wstring_t *wstr, const wchar_t *chars);
+
 /**
  * Replaces any occurence of substr with replacement
  * @param substr string to replace
@@ -171,6 +349,21 @@ int wstr_replace(wstring_t *wstr, const wchar_t *substr, const wchar_t *replacem
  */
 int wstr_transform(wstring_t *wstr, wchar_t(*func)(wchar_t));
 
+/**
+ * Replaces the contents of wstr with their full Unicode case folding.
+ * Unlike wstr_transform with towlower, it doesn't depend on the locale,
+ * and a character can fold into several (L'\u00DF' folds into L"ss").
+ * @return 1 on success, -1 if wstr is NULL
+ */
+int wstr_casefold(wstring_t *wstr);
+
+/**
+ * Puts wstr in Unicode Normalization Form C (composed) or D (decomposed).
+ * @return 1 on success, -1 if wstr is NULL
+ */
+int wstr_normalize_nfc(wstring_t *wstr);
+int wstr_normalize_nfd(wstring_t *wstr);
+
 /**
  * Shrinks the given string to fit it's content
  */
@@ -208,4 +401,8 @@ void wstr_free(wstring_t *wstr, ...);
 */
 void wstr_free_all(unsigned int n, ...);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif // WSTR_H